@@ -0,0 +1,1112 @@
+// 2026-10  lcg_predict_bench.cpp
+
+#include "../include/lcg_predict.hpp"
+#include "../include/lcg_predict_fingerprint.hpp"
+#include "../include/lcg_predict_matrix.hpp"
+#include "../include/lcg_predict_parallel.hpp"
+#include "../include/lcg_predict_pool.hpp"
+#include "../include/lcg_predict_search.hpp"
+#include "../include/lcg_predict_segments.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// Keeps `value` observable, so that the measured work is not optimized away.
+template <typename T>
+auto do_not_optimize(const T& value) noexcept -> void
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename F>
+[[nodiscard]] auto nanoseconds_per_op(std::size_t iterations, F&& f) -> double
+{
+    const auto start { std::chrono::steady_clock::now() };
+    for (std::size_t i { 0 }; i != iterations; ++i) {
+        f(i);
+    }
+    const std::chrono::duration<double, std::nano> elapsed { std::chrono::steady_clock::now() - start };
+    return elapsed.count() / static_cast<double>(iterations);
+}
+
+// Time stamp counter ticks per nanosecond, measured against `steady_clock`, or 0 without a counter.
+// The counter ticks at a constant rate, the nominal frequency, whatever the actual clock of the core.
+[[nodiscard]] auto measure_cycles_per_nanosecond() -> double
+{
+#if defined(__x86_64__) || defined(__i386__)
+    const auto start { std::chrono::steady_clock::now() };
+    const unsigned long long start_cycles { __rdtsc() };
+    auto now { start };
+    while (now - start < std::chrono::milliseconds { 50 }) {
+        now = std::chrono::steady_clock::now();
+    }
+    const unsigned long long cycles { __rdtsc() - start_cycles };
+    const std::chrono::duration<double, std::nano> elapsed { now - start };
+    return static_cast<double>(cycles) / elapsed.count();
+#else
+    return 0;
+#endif
+}
+
+double cycles_per_nanosecond {}; // NOLINT : measured once by `main`.
+
+// `ns` in cycles, or in nanoseconds without a counter.
+[[nodiscard]] auto to_cycles(double ns) noexcept -> double
+{
+    return cycles_per_nanosecond != 0 ? ns * cycles_per_nanosecond : ns;
+}
+
+[[nodiscard]] auto cycles_unit() noexcept -> const char*
+{
+    return cycles_per_nanosecond != 0 ? "cycles" : "ns";
+}
+
+// One measured value, for comparing runs: `--csv <path>` writes them all.
+struct Result {
+    std::string section;
+    std::string name;
+    std::string metric;
+    double value;
+};
+
+std::vector<Result> results {}; // NOLINT : filled by every section, written by `main`.
+std::string_view current_section {}; // NOLINT : set by `main` before each section.
+
+// Records the values of a row, in nanoseconds unless the metric says otherwise.
+auto record(std::string_view name, std::initializer_list<std::pair<std::string_view, double>> values) -> void
+{
+    for (const auto& [metric, value] : values) {
+        results.push_back(Result { std::string { current_section }, std::string { name }, std::string { metric }, value });
+    }
+}
+
+// Writes `results` as CSV. Names and metrics contain no commas or quotes.
+[[nodiscard]] auto write_results(const std::filesystem::path& path) -> bool
+{
+    std::ofstream file { path };
+    file << "section,name,metric,value\n";
+    file.precision(17);
+    for (const Result& result : results) {
+        file << result.section << ',' << result.name << ',' << result.metric << ',' << result.value << '\n';
+    }
+    return static_cast<bool>(file.flush());
+}
+
+// The arithmetic before reduction strategies: a widening `%` by a run-time modulus.
+template <std::unsigned_integral T, typename Bigger = detail::least_doubled_uint_t<T>>
+struct GenericAffine {
+
+    T a;
+    T c;
+    Bigger real_m;
+
+    [[nodiscard]] auto operator()(T x) const noexcept -> T
+    {
+        return static_cast<T>(((static_cast<Bigger>(a) * x) + c) % real_m);
+    }
+
+    [[nodiscard]] auto powered(unsigned long long n) const noexcept -> GenericAffine
+    {
+        const auto composer {
+            [](const GenericAffine& lhs, const GenericAffine& rhs) noexcept -> GenericAffine {
+                return GenericAffine {
+                    static_cast<T>((static_cast<Bigger>(lhs.a) * rhs.a) % lhs.real_m),
+                    lhs(rhs.c),
+                    lhs.real_m,
+                };
+            }
+        };
+        return detail::double_and_add(*this, n, composer, GenericAffine { 1, 0, real_m });
+    }
+};
+
+template <std::unsigned_integral T, typename Bigger = detail::least_doubled_uint_t<T>>
+[[nodiscard]] auto make_generic(const LCGAffineTransform<T>& affine) noexcept -> GenericAffine<T, Bigger>
+{
+    const Bigger real_m { affine.m() != 0 ? Bigger { affine.m() } : Bigger { std::numeric_limits<T>::max() } + 1 };
+    return GenericAffine<T, Bigger> { affine.a(), affine.c(), real_m };
+}
+
+[[nodiscard]] constexpr auto kind_name(detail::ReductionKind kind) noexcept -> std::string_view
+{
+    switch (kind) {
+    case detail::ReductionKind::mask:
+        return "mask";
+    case detail::ReductionKind::mersenne:
+        return "mersenne";
+    case detail::ReductionKind::barrett:
+        return "barrett";
+    }
+    return "?";
+}
+
+// Step counts spread over the whole range of `unsigned long long`.
+[[nodiscard]] constexpr auto jump_distance(std::size_t i) noexcept -> unsigned long long
+{
+    return (static_cast<unsigned long long>(i) + 1) * 0x9e37'79b9'7f4a'7c15ULL;
+}
+
+constexpr std::size_t step_iterations { 20'000'000 };
+constexpr std::size_t powered_iterations { 200'000 };
+
+template <std::unsigned_integral T>
+auto bench_reduction(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    const LCGAffineTransform<T> affine { preset.affine() };
+    const GenericAffine<T> generic { make_generic(affine) };
+
+    // Both steps in the same frame, a state local to the caller, as in `bench_doubled`. Stepping `LCGEngine` itself
+    // keeps the state in the engine, whose store and reload cost as much as the reduction, and move with the code
+    // around the loop.
+    const auto bench_step {
+        [&preset](const auto& step, T& state) -> double {
+            state = preset.state();
+            return nanoseconds_per_op(step_iterations, [&step, &state](std::size_t) {
+                state = step(state);
+                do_not_optimize(state);
+            });
+        }
+    };
+    T state {};
+    T generic_state {};
+    const double step_ns { bench_step(affine, state) };
+    const double generic_step_ns { bench_step(generic, generic_state) };
+
+    const double powered_ns { nanoseconds_per_op(powered_iterations, [&affine](std::size_t i) { do_not_optimize(affine.powered(jump_distance(i))); }) };
+    const double generic_powered_ns { nanoseconds_per_op(powered_iterations, [&generic](std::size_t i) { do_not_optimize(generic.powered(jump_distance(i))); }) };
+
+    record(name, { { "step:%", generic_step_ns }, { "step", step_ns }, { "powered:%", generic_powered_ns }, { "powered", powered_ns } });
+    std::printf("%-16.*s %-9.*s %10.2f %10.2f %8.2fx %12.1f %12.1f %8.2fx\n",
+        static_cast<int>(name.size()), name.data(),
+        static_cast<int>(kind_name(detail::UnsignedModder<T> { affine.m() }.kind()).size()), kind_name(detail::UnsignedModder<T> { affine.m() }.kind()).data(),
+        generic_step_ns, step_ns, generic_step_ns / step_ns,
+        generic_powered_ns, powered_ns, generic_powered_ns / powered_ns);
+}
+
+auto bench_reductions() -> void
+{
+    std::printf("# Reduction strategies: generic widening %% against UnsignedModder (ns/op)\n");
+    std::printf("%-16s %-9s %10s %10s %9s %12s %12s %9s\n",
+        "preset", "kind", "step:%", "step", "speedup", "powered:%", "powered", "speedup");
+    bench_reduction("krc_rand", krc_rand_engine);
+    bench_reduction("minstd_rand", minstd_rand_engine);
+    bench_reduction("minstd_rand0", minstd_rand0_engine);
+    bench_reduction("msvc_rand", msvc_rand_engine);
+    bench_reduction("posix_rand48", posix_rand48_engine);
+    bench_reduction("musl_rand", musl_rand_engine);
+    bench_reduction("barrett_1e18+3", LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U });
+}
+
+#if defined(__SIZEOF_INT128__)
+// `UnsignedModder` and the widening `%`, with `__uint128_t` and with `UnsignedDoubledLongLong` as double-width type.
+template <std::unsigned_integral T>
+auto bench_doubled(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    using Doubled = detail::UnsignedDoubledLongLong;
+    const LCGAffineTransform<T> affine { preset.affine() };
+    const detail::UnsignedModder<T, __uint128_t> native_modder { affine.m() };
+    const detail::UnsignedModder<T, Doubled> modder { affine.m() };
+
+    const auto bench_step {
+        [&affine, &preset](const auto& step_modder, T& state) -> double {
+            state = preset.state();
+            return nanoseconds_per_op(step_iterations, [&affine, &step_modder, &state](std::size_t) {
+                state = step_modder.times_plus_mod(affine.a(), state, affine.c());
+                do_not_optimize(state);
+            });
+        }
+    };
+    const auto bench_pow {
+        [&affine](const auto& pow_modder, T& result) -> double {
+            return nanoseconds_per_op(powered_iterations, [&affine, &pow_modder, &result](std::size_t i) {
+                result = pow_modder.pow_mod(affine.a(), jump_distance(i));
+                do_not_optimize(result);
+            });
+        }
+    };
+    const auto bench_generic {
+        [&preset](const auto& generic, T& state) -> double {
+            state = preset.state();
+            return nanoseconds_per_op(step_iterations, [&generic, &state](std::size_t) {
+                state = generic(state);
+                do_not_optimize(state);
+            });
+        }
+    };
+
+    T native_state {};
+    T state {};
+    const double native_step_ns { bench_step(native_modder, native_state) };
+    const double step_ns { bench_step(modder, state) };
+    T native_power {};
+    T power {};
+    const double native_pow_ns { bench_pow(native_modder, native_power) };
+    const double pow_ns { bench_pow(modder, power) };
+    T native_generic_state {};
+    T generic_state {};
+    const double native_generic_ns { bench_generic(make_generic<T, __uint128_t>(affine), native_generic_state) };
+    const double generic_ns { bench_generic(make_generic<T, Doubled>(affine), generic_state) };
+
+    const bool same { native_state == state && native_power == power && native_generic_state == generic_state };
+    record(name, { { "step:u128", native_step_ns }, { "step", step_ns }, { "pow:u128", native_pow_ns }, { "pow", pow_ns }, { "%:u128", native_generic_ns }, { "%", generic_ns } });
+    std::printf("%-16.*s %10.2f %10.2f %10.1f %10.1f %10.2f %10.2f%s\n",
+        static_cast<int>(name.size()), name.data(),
+        native_step_ns, step_ns, native_pow_ns, pow_ns, native_generic_ns, generic_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_doubleds() -> void
+{
+    std::printf("# Double-width type: __uint128_t against UnsignedDoubledLongLong (ns/op)\n");
+    std::printf("%-16s %10s %10s %10s %10s %10s %10s\n",
+        "preset", "step:u128", "step", "pow:u128", "pow", "%:u128", "%");
+    bench_doubled("musl_rand", musl_rand_engine);
+    bench_doubled("posix_rand48", posix_rand48_engine);
+    bench_doubled("minstd_rand", minstd_rand_engine);
+    bench_doubled("barrett_1e18+3", LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U });
+}
+
+// 128-bit states, with `__uint128_t` and with `UnsignedDoubledLongLong` as state type.
+// Jumps are by 128-bit step counts, spread over the whole range.
+auto bench_wide(std::string_view name, __uint128_t a, __uint128_t c, __uint128_t m) -> void
+{
+    using detail::UnsignedDoubledLongLong;
+    const LCGEngine<__uint128_t> native_preset { a, c, m, 42U };
+    const LCGEngine<UnsignedDoubledLongLong> preset { a, c, m, 42U };
+    const auto wide_jump_distance {
+        [](std::size_t i) noexcept -> __uint128_t {
+            return (static_cast<__uint128_t>(jump_distance(i)) << 64U) | jump_distance(i + 1);
+        }
+    };
+
+    LCGEngine<__uint128_t> native_engine { native_preset };
+    LCGEngine<UnsignedDoubledLongLong> engine { preset };
+    const double native_step_ns { nanoseconds_per_op(step_iterations / 4, [&native_engine](std::size_t) {
+        do_not_optimize(native_engine());
+    }) };
+    const double step_ns { nanoseconds_per_op(step_iterations / 4, [&engine](std::size_t) {
+        do_not_optimize(engine());
+    }) };
+    __uint128_t native_jumped {};
+    UnsignedDoubledLongLong jumped {};
+    const double native_jump_ns { nanoseconds_per_op(powered_iterations / 10, [&native_preset, &native_jumped, &wide_jump_distance](std::size_t i) {
+        native_jumped = native_preset.value_after_n_steps(wide_jump_distance(i));
+        do_not_optimize(native_jumped);
+    }) };
+    const double jump_ns { nanoseconds_per_op(powered_iterations / 10, [&preset, &jumped, &wide_jump_distance](std::size_t i) {
+        jumped = preset.value_after_n_steps(UnsignedDoubledLongLong { wide_jump_distance(i) });
+        do_not_optimize(jumped);
+    }) };
+
+    const bool same { native_engine.state() == static_cast<__uint128_t>(engine.state()) && native_jumped == static_cast<__uint128_t>(jumped) };
+    record(name, { { "step:u128", native_step_ns }, { "step", step_ns }, { "jump:u128", native_jump_ns }, { "jump", jump_ns } });
+    std::printf("%-16.*s %-8.*s %10.2f %10.2f %10.1f %10.1f%s\n",
+        static_cast<int>(name.size()), name.data(),
+        static_cast<int>(kind_name(preset.affine().modder().kind()).size()), kind_name(preset.affine().modder().kind()).data(),
+        native_step_ns, step_ns, native_jump_ns, jump_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_wides() -> void
+{
+    std::printf("# 128-bit state: __uint128_t against UnsignedDoubledLongLong (ns/op)\n");
+    std::printf("%-16s %-8s %10s %10s %10s %10s\n", "preset", "kind", "step:u128", "step", "jump:u128", "jump");
+    const __uint128_t pcg64_a { (static_cast<__uint128_t>(0x2360'ed05'1fc6'5da4ULL) << 64U) | 0x4385'df64'9fcc'f645ULL };
+    const __uint128_t pcg64_c { (static_cast<__uint128_t>(0x5851'f42d'4c95'7f2dULL) << 64U) | 0x1405'7b7e'f767'814fULL };
+    bench_wide("pcg64", pcg64_a, pcg64_c, 0U);
+    bench_wide("mersenne_2^127-1", pcg64_a, pcg64_c, (static_cast<__uint128_t>(1) << 127U) - 1U);
+    bench_wide("barrett_1e38+3", pcg64_a, pcg64_c, (static_cast<__uint128_t>(10'000'000'000'000'000'000ULL) * 10'000'000'000'000'000'000ULL) + 3U);
+}
+#endif
+
+template <std::unsigned_integral T>
+auto bench_generation(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t buffer_size { 1 << 20 };
+    constexpr std::size_t repetitions { 20 };
+    std::vector<T> buffer(buffer_size);
+
+    LCGEngine<T> stepping { preset };
+    const double step_ns { nanoseconds_per_op(repetitions, [&stepping, &buffer](std::size_t) {
+        for (T& value : buffer) {
+            value = stepping();
+        }
+        do_not_optimize(buffer.data());
+    }) / buffer_size };
+    LCGEngine<T> generating { preset };
+    const double generate_ns { nanoseconds_per_op(repetitions, [&generating, &buffer](std::size_t) {
+        generating.generate(buffer);
+        do_not_optimize(buffer.data());
+    }) / buffer_size };
+
+    record(name, { { "loop", step_ns }, { "generate", generate_ns } });
+    std::printf("%-16.*s %10.3f %10.3f %8.2fx\n",
+        static_cast<int>(name.size()), name.data(), step_ns, generate_ns, step_ns / generate_ns);
+}
+
+// A preset against the `std::linear_congruential_engine` with the same parameters: `operator()`, `discard`, which
+// the standard library does one step at a time, and conversions: `from_std` against the stream operator, and
+// `from_std` and `to_std` over spans.
+template <typename StdEngine>
+auto bench_std(std::string_view name) -> void
+{
+    using T = typename StdEngine::result_type;
+    constexpr unsigned long long discard_distance { 1 << 16 };
+    constexpr std::size_t discard_iterations { 200 };
+    constexpr std::size_t from_std_iterations { 100'000 };
+
+    StdEngine std_engine {};
+    const double std_step_ns { nanoseconds_per_op(step_iterations, [&std_engine](std::size_t) { do_not_optimize(std_engine()); }) };
+    LCGEngine<T> engine { LCGEngine<T>::from_std(StdEngine {}) };
+    const double step_ns { nanoseconds_per_op(step_iterations, [&engine](std::size_t) { do_not_optimize(engine()); }) };
+    StaticLCGEngine<T, StdEngine::multiplier, StdEngine::increment, StdEngine::modulus> static_engine {};
+    const double static_ns { nanoseconds_per_op(step_iterations, [&static_engine](std::size_t) { do_not_optimize(static_engine()); }) };
+
+    StdEngine std_discarded {};
+    const double std_discard_ns { nanoseconds_per_op(discard_iterations, [&std_discarded](std::size_t) {
+        std_discarded.discard(discard_distance);
+        do_not_optimize(std_discarded);
+    }) };
+    LCGEngine<T> discarded { LCGEngine<T>::from_std(StdEngine {}) };
+    const double discard_ns { nanoseconds_per_op(powered_iterations, [&discarded](std::size_t) {
+        discarded.discard(discard_distance);
+        do_not_optimize(discarded);
+    }) };
+
+    const StdEngine from { 12345U };
+    T last {};
+    const double from_std_ns { nanoseconds_per_op(from_std_iterations, [&from, &last](std::size_t) {
+        last = LCGEngine<T>::from_std(from).state();
+        do_not_optimize(last);
+    }) };
+    // The stream operator, which `from_std` only falls back to when a is not invertible.
+    T streamed {};
+    const double stream_ns { nanoseconds_per_op(from_std_iterations, [&from, &streamed](std::size_t) {
+        std::ostringstream oss {};
+        oss << from;
+        std::istringstream iss { oss.str() };
+        iss >> streamed;
+        do_not_optimize(streamed);
+    }) };
+
+    // Bulk conversions, per engine.
+    constexpr std::size_t bulk_size { 1 << 12 };
+    std::vector<StdEngine> std_engines {};
+    for (std::size_t i { 0 }; i != bulk_size; ++i) {
+        std_engines.emplace_back(static_cast<T>(i + 1));
+    }
+    std::vector<LCGEngine<T>> engines(bulk_size, engine);
+    const double bulk_from_ns { nanoseconds_per_op(from_std_iterations / bulk_size, [&std_engines, &engines](std::size_t) {
+        LCGEngine<T>::template from_std<StdEngine>(std_engines, engines);
+        do_not_optimize(engines.data());
+    }) / bulk_size };
+    std::vector<StdEngine> std_converted(bulk_size);
+    const double bulk_to_ns { nanoseconds_per_op(from_std_iterations / bulk_size, [&engines, &std_converted](std::size_t) {
+        LCGEngine<T>::template to_std<StdEngine>(engines, std_converted);
+        do_not_optimize(std_converted.data());
+    }) / bulk_size };
+
+    StdEngine std_check { std_discarded };
+    LCGEngine<T> check { LCGEngine<T>::from_std(StdEngine {}) };
+    check.discard(discard_iterations * discard_distance);
+    const bool same { check() == std_check() && engine.state() == static_engine.state()
+        && last == streamed && last == LCGEngine<T>::from_std(from).state() && std_converted == std_engines };
+    record(name, { { "std step", std_step_ns }, { "step", step_ns }, { "static step", static_ns },
+                     { "std discard 2^16", std_discard_ns }, { "discard 2^16", discard_ns }, { "from_std", from_std_ns },
+                     { "stream", stream_ns }, { "bulk from_std", bulk_from_ns }, { "bulk to_std", bulk_to_ns } });
+    std::printf("%-16.*s %4d %10.2f %10.2f %10.2f %12.0f %12.1f %10.1f %10.1f %10.1f %10.1f%s\n",
+        static_cast<int>(name.size()), name.data(), std::numeric_limits<T>::digits,
+        to_cycles(std_step_ns), to_cycles(step_ns), to_cycles(static_ns),
+        to_cycles(std_discard_ns), to_cycles(discard_ns), to_cycles(from_std_ns),
+        to_cycles(stream_ns), to_cycles(bulk_from_ns), to_cycles(bulk_to_ns), same ? "" : "  MISMATCH");
+}
+
+auto bench_stds() -> void
+{
+    std::printf("# Standard library: std::linear_congruential_engine against LCGEngine and StaticLCGEngine, discard(2^16) (%s/op)\n", cycles_unit());
+    std::printf("%-16s %4s %10s %10s %10s %12s %12s %10s %10s %10s %10s\n", "preset", "bits", "std step", "step", "static", "std discard", "discard", "from_std", "stream", "bulk from", "bulk to");
+    bench_std<std::linear_congruential_engine<std::uint_fast32_t, 1103515245, 12345, 2147483648>>("krc_rand");
+    bench_std<std::minstd_rand>("minstd_rand");
+    bench_std<std::minstd_rand0>("minstd_rand0");
+    bench_std<std::linear_congruential_engine<std::uint_fast32_t, 214013, 2531011, 2147483648>>("msvc_rand");
+    bench_std<std::linear_congruential_engine<std::uint_fast64_t, 25214903917, 11, 281474976710656>>("posix_rand48");
+    bench_std<std::linear_congruential_engine<std::uint_fast64_t, 6364136223846793005, 1, 0>>("musl_rand");
+    bench_std<std::linear_congruential_engine<std::uint16_t, 17364, 0, 65521>>("lecuyer<u16>");
+    bench_std<std::linear_congruential_engine<std::uint32_t, 1103515245, 12345, 2147483648>>("krc_rand<u32>");
+    // The standard requires a, c < m: the multiplier and increment of the other benchmarks, reduced.
+    bench_std<std::linear_congruential_engine<std::uint64_t, 935559000370003836U, 691343689449507675U, 1000000000000000003U>>("barrett_1e18+3");
+}
+
+// Latency of `value_after_n_steps(n)` as n grows: each call starts from the value of the previous one.
+template <std::unsigned_integral T>
+auto bench_latency(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::array<int, 6> bit_counts { 1, 8, 16, 32, 48, 64 };
+    std::array<double, bit_counts.size()> ns {};
+    for (std::size_t k { 0 }; k != bit_counts.size(); ++k) {
+        const unsigned long long steps { std::numeric_limits<unsigned long long>::max() >> (64 - bit_counts[k]) };
+        LCGEngine<T> engine { preset };
+        ns[k] = nanoseconds_per_op(powered_iterations, [&engine, steps](std::size_t) {
+            engine.set_state(engine.value_after_n_steps(steps));
+        });
+        do_not_optimize(engine.state());
+    }
+    record(name, { { "2^1-1", ns[0] }, { "2^8-1", ns[1] }, { "2^16-1", ns[2] }, { "2^32-1", ns[3] }, { "2^48-1", ns[4] }, { "2^64-1", ns[5] } });
+    std::printf("%-16.*s %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+        static_cast<int>(name.size()), name.data(),
+        to_cycles(ns[0]), to_cycles(ns[1]), to_cycles(ns[2]), to_cycles(ns[3]), to_cycles(ns[4]), to_cycles(ns[5]));
+}
+
+auto bench_latencies() -> void
+{
+    std::printf("# Jump latency: value_after_n_steps(2^k - 1), dependent calls (%s/op)\n", cycles_unit());
+    std::printf("%-16s %10s %10s %10s %10s %10s %10s\n", "preset", "k = 1", "8", "16", "32", "48", "64");
+    bench_latency("krc_rand", krc_rand_engine);
+    bench_latency("minstd_rand", minstd_rand_engine);
+    bench_latency("minstd_rand0", minstd_rand0_engine);
+    bench_latency("msvc_rand", msvc_rand_engine);
+    bench_latency("posix_rand48", posix_rand48_engine);
+    bench_latency("musl_rand", musl_rand_engine);
+    bench_latency("lecuyer<u16>", LCGEngine<std::uint16_t> { 17364, 0, 65521 });
+    bench_latency("krc_rand<u32>", LCGEngine<std::uint32_t> { 1103515245, 12345, 2147483648 });
+    bench_latency("barrett_1e18+3", LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U });
+}
+
+// A period as text: 2^64 does not fit in `unsigned long long`.
+template <typename P>
+[[nodiscard]] auto period_text(const P& period) -> std::string
+{
+    if constexpr (sizeof(P) > sizeof(unsigned long long)) {
+        if (period > P { std::numeric_limits<unsigned long long>::max() }) {
+            return period == P { 1 } << 64U ? "2^64" : "> 2^64";
+        }
+    }
+    return std::to_string(static_cast<unsigned long long>(period));
+}
+
+// `period()` and `cycle_length()`, which factorize m every time, against `cycle_length` through a prebuilt
+// `LCGCycleStructure`, in microseconds.
+template <std::unsigned_integral T>
+auto bench_period(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t iterations { 200 };
+    using period_type = typename LCGCycleStructure<T>::period_type;
+
+    period_type period {};
+    const double period_ns { nanoseconds_per_op(iterations, [&preset, &period](std::size_t) {
+        period = preset.period();
+        do_not_optimize(period);
+    }) };
+    LCGEngine<T> engine { preset };
+    period_type cycle {};
+    const double cycle_ns { nanoseconds_per_op(iterations, [&engine, &cycle](std::size_t i) {
+        engine.set_state(static_cast<T>(i + 2));
+        cycle = engine.cycle_length();
+        do_not_optimize(cycle);
+    }) };
+    const LCGCycleStructure<T> structure { preset.affine() };
+    period_type cached {};
+    const double cached_ns { nanoseconds_per_op(iterations, [&engine, &structure, &cached](std::size_t i) {
+        engine.set_state(static_cast<T>(i + 2));
+        cached = engine.cycle_length(structure);
+        do_not_optimize(cached);
+    }) };
+
+    const bool same { period == structure.period() && cycle == cached };
+    record(name, { { "period", period_ns }, { "cycle_length", cycle_ns }, { "cycle_length (structure)", cached_ns } });
+    std::printf("%-16.*s %20s %12.2f %12.2f %12.2f%s\n",
+        static_cast<int>(name.size()), name.data(), period_text(period).c_str(),
+        period_ns / 1000, cycle_ns / 1000, cached_ns / 1000, same ? "" : "  MISMATCH");
+}
+
+auto bench_periods() -> void
+{
+    std::printf("# Periods: period(), cycle_length() and cycle_length(structure) (us/op)\n");
+    std::printf("%-16s %20s %12s %12s %12s\n", "preset", "period", "period", "cycle", "structure");
+    bench_period("krc_rand", krc_rand_engine);
+    bench_period("minstd_rand", minstd_rand_engine);
+    bench_period("minstd_rand0", minstd_rand0_engine);
+    bench_period("msvc_rand", msvc_rand_engine);
+    bench_period("posix_rand48", posix_rand48_engine);
+    bench_period("musl_rand", musl_rand_engine);
+    bench_period("lecuyer<u16>", LCGEngine<std::uint16_t> { 17364, 0, 65521 });
+    bench_period("barrett_1e18+3", LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U });
+    // c even modulo 2^64, and 2^61 - 1, whose p - 1 has large prime factors.
+    bench_period("pcg_c_even", LCGEngine<std::uint64_t> { 6364136223846793005U, 2, 0 });
+    bench_period("mersenne_2^61-1", LCGEngine<std::uint64_t> { 437799614237992725U, 7, 2305843009213693951U });
+}
+
+// Reading values through `sequence()` against calling `operator()`, and seeking with `operator[]`.
+template <std::unsigned_integral T>
+auto bench_sequence(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t count { 1 << 20 };
+    constexpr std::size_t repetitions { 20 };
+
+    LCGEngine<T> engine { preset };
+    const double step_ns { nanoseconds_per_op(repetitions, [&engine](std::size_t) {
+        for (std::size_t i { 0 }; i != count; ++i) {
+            do_not_optimize(engine());
+        }
+    }) / count };
+    T last {};
+    const double view_ns { nanoseconds_per_op(repetitions, [&preset, &last](std::size_t i) {
+        for (const T value : preset.sequence(i * count, (i + 1) * count)) {
+            do_not_optimize(value);
+            last = value;
+        }
+    }) / count };
+    const LCGSequenceView<T> sequence { preset.sequence(std::numeric_limits<unsigned long long>::max()) };
+    const double seek_ns { nanoseconds_per_op(powered_iterations, [&sequence](std::size_t i) {
+        do_not_optimize(sequence[jump_distance(i) >> 1U]);
+    }) };
+
+    const bool same { last == preset.value_after_n_steps(repetitions * count) };
+    record(name, { { "loop", step_ns }, { "view", view_ns }, { "seek", seek_ns } });
+    std::printf("%-16.*s %10.3f %10.3f %10.1f%s\n",
+        static_cast<int>(name.size()), name.data(), step_ns, view_ns, seek_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_sequences() -> void
+{
+    std::printf("# Sequence view: operator() against iterating sequence() (ns/value), and seeking sequence()[n] (ns/op)\n");
+    std::printf("%-16s %10s %10s %10s\n", "preset", "loop", "view", "seek");
+    bench_sequence("krc_rand", krc_rand_engine);
+    bench_sequence("minstd_rand", minstd_rand_engine);
+    bench_sequence("posix_rand48", posix_rand48_engine);
+    bench_sequence("musl_rand", musl_rand_engine);
+}
+
+template <std::unsigned_integral T>
+auto bench_sum(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t count { 1 << 20 };
+    constexpr std::size_t repetitions { 20 };
+    const detail::UnsignedModder<T> modder { preset.m() };
+
+    T loop_sum {};
+    const double loop_ns { nanoseconds_per_op(repetitions, [&preset, &modder, &loop_sum](std::size_t) {
+        LCGEngine<T> engine { preset };
+        T sum { 0 };
+        for (std::size_t i { 0 }; i != count; ++i) {
+            sum = modder.plus_mod(sum, engine());
+        }
+        do_not_optimize(sum);
+        loop_sum = sum;
+    }) };
+    T closed_sum {};
+    const double closed_ns { nanoseconds_per_op(powered_iterations, [&preset, &closed_sum](std::size_t i) {
+        closed_sum = preset.sum_of_next(count + (i & 1U));
+        do_not_optimize(closed_sum);
+    }) };
+    const double squares_ns { nanoseconds_per_op(powered_iterations, [&preset](std::size_t i) {
+        do_not_optimize(preset.sum_of_squares_of_next(count + (i & 1U)));
+    }) };
+
+    const bool same { loop_sum == preset.sum_of_next(count) };
+    record(name, { { "loop", loop_ns }, { "sum_of_next", closed_ns }, { "squares", squares_ns } });
+    std::printf("%-16.*s %12.0f %12.1f %12.1f%s\n",
+        static_cast<int>(name.size()), name.data(), loop_ns, closed_ns, squares_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_sums() -> void
+{
+    std::printf("# Sum of the next 2^20 values: operator() in a loop against sum_of_next, and sum_of_squares_of_next (ns/op)\n");
+    std::printf("%-16s %12s %12s %12s\n", "preset", "loop", "sum_of_next", "squares");
+    bench_sum("krc_rand", krc_rand_engine);
+    bench_sum("minstd_rand", minstd_rand_engine);
+    bench_sum("posix_rand48", posix_rand48_engine);
+    bench_sum("musl_rand", musl_rand_engine);
+}
+
+auto bench_generations() -> void
+{
+    std::printf("# Bulk generation: operator() in a loop against generate (ns/value)\n");
+    std::printf("%-16s %10s %10s %9s\n", "preset", "loop", "generate", "speedup");
+    bench_generation("krc_rand", krc_rand_engine);
+    bench_generation("minstd_rand", minstd_rand_engine);
+    bench_generation("minstd_rand0", minstd_rand0_engine);
+    bench_generation("msvc_rand", msvc_rand_engine);
+    bench_generation("posix_rand48", posix_rand48_engine);
+    bench_generation("musl_rand", musl_rand_engine);
+    bench_generation("krc_rand<u32>", LCGEngine<std::uint32_t> { 1103515245, 12345, 2147483648 });
+}
+
+auto bench_parallel_generations() -> void
+{
+    constexpr std::size_t buffer_size { std::size_t { 1 } << 24 };
+    constexpr std::size_t repetitions { 5 };
+    const std::size_t max_threads { std::max(std::thread::hardware_concurrency(), 1U) };
+    std::vector<std::uint_fast64_t> buffer(buffer_size);
+    std::vector<std::uint_fast64_t> serial(buffer_size);
+    LCGEngine<std::uint_fast64_t> { musl_rand_engine }.generate(serial);
+
+    std::printf("# Parallel generation of musl_rand, %zu values (ns/value)\n", buffer_size);
+    std::printf("%-16s %10s %9s\n", "threads", "generate", "speedup");
+    // 1, 2, 4, ... and `max_threads`.
+    std::vector<std::size_t> thread_counts {};
+    for (std::size_t threads { 1 }; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    double one_thread_ns {};
+    for (const std::size_t threads : thread_counts) {
+        LCGEngine<std::uint_fast64_t> engine { musl_rand_engine };
+        const double ns { nanoseconds_per_op(repetitions, [&engine, &buffer, threads](std::size_t) {
+            parallel_generate<std::uint_fast64_t>(engine, buffer, threads);
+            do_not_optimize(buffer.data());
+        }) / buffer_size };
+        if (threads == 1) {
+            one_thread_ns = ns;
+        }
+        // `engine` has moved past the start of the stream, so check a fresh fill against `serial`.
+        LCGEngine<std::uint_fast64_t> check { musl_rand_engine };
+        parallel_generate<std::uint_fast64_t>(check, buffer, threads);
+        record(std::to_string(threads), { { "generate", ns } });
+        std::printf("%-16zu %10.3f %8.2fx%s\n", threads, ns, one_thread_ns / ns, buffer == serial ? "" : "  MISMATCH");
+    }
+}
+
+template <std::unsigned_integral T>
+auto bench_pool(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t engine_count { 1 << 14 };
+    constexpr std::size_t repetitions { 200 };
+    std::vector<LCGEngine<T>> separate(engine_count, preset);
+    LCGEnginePool<T> pool { preset.affine(), engine_count, preset.state() };
+    std::vector<unsigned long long> n(engine_count);
+    for (std::size_t i { 0 }; i != engine_count; ++i) {
+        n[i] = (i * 0x9e3779b97f4a7c15ULL) >> 24;
+    }
+
+    const double separate_step_ns { nanoseconds_per_op(repetitions, [&separate](std::size_t) {
+        for (LCGEngine<T>& engine : separate) {
+            do_not_optimize(engine());
+        }
+    }) / engine_count };
+    const double pool_step_ns { nanoseconds_per_op(repetitions, [&pool](std::size_t) {
+        pool.step_all();
+        do_not_optimize(pool.states().data());
+    }) / engine_count };
+    const double separate_discard_ns { nanoseconds_per_op(repetitions / 10, [&separate, &n](std::size_t) {
+        for (std::size_t i { 0 }; i != engine_count; ++i) {
+            separate[i].discard(n[i]);
+        }
+        do_not_optimize(separate.data());
+    }) / engine_count };
+    const double pool_discard_ns { nanoseconds_per_op(repetitions / 10, [&pool, &n](std::size_t) {
+        pool.discard_each(n);
+        do_not_optimize(pool.states().data());
+    }) / engine_count };
+
+    record(name, { { "step", separate_step_ns }, { "step_all", pool_step_ns }, { "discard", separate_discard_ns }, { "each", pool_discard_ns } });
+    std::printf("%-16.*s %10.3f %10.3f %8.2fx %10.3f %10.3f %8.2fx\n",
+        static_cast<int>(name.size()), name.data(),
+        separate_step_ns, pool_step_ns, separate_step_ns / pool_step_ns,
+        separate_discard_ns, pool_discard_ns, separate_discard_ns / pool_discard_ns);
+}
+
+auto bench_pools() -> void
+{
+    std::printf("# Engine pools: separate LCGEngines against LCGEnginePool (ns/engine)\n");
+    std::printf("%-16s %10s %10s %9s %10s %10s %9s\n", "preset", "step", "step_all", "speedup", "discard", "each", "speedup");
+    bench_pool("krc_rand", krc_rand_engine);
+    bench_pool("minstd_rand", minstd_rand_engine);
+    bench_pool("msvc_rand", msvc_rand_engine);
+    bench_pool("posix_rand48", posix_rand48_engine);
+    bench_pool("musl_rand", musl_rand_engine);
+    bench_pool("krc_rand<u32>", LCGEngine<std::uint32_t> { 1103515245, 12345, 2147483648 });
+}
+
+// Random access: a `powered` per index against `values_at`, for indices spread over [0, 2^40).
+template <std::unsigned_integral T>
+auto bench_values_at(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t index_count { 1 << 12 };
+    constexpr std::size_t repetitions { 50 };
+    const LCGJumpTable<T, 4> table { preset.affine() };
+    std::vector<unsigned long long> unsorted(index_count);
+    for (std::size_t i { 0 }; i != index_count; ++i) {
+        unsorted[i] = ((i + 1) * 0x9e37'79b9'7f4a'7c15ULL) >> 24;
+    }
+    std::vector<unsigned long long> sorted { unsorted };
+    std::ranges::sort(sorted);
+    std::vector<T> expected(index_count);
+    std::vector<T> sorted_values(index_count);
+    std::vector<T> unsorted_values(index_count);
+    std::vector<T> parallel_values(index_count);
+
+    const double each_ns { nanoseconds_per_op(repetitions, [&preset, &unsorted, &expected](std::size_t) {
+        for (std::size_t i { 0 }; i != index_count; ++i) {
+            expected[i] = preset.value_after_n_steps(unsorted[i]);
+        }
+        do_not_optimize(expected.data());
+    }) / index_count };
+    const double sorted_ns { nanoseconds_per_op(repetitions, [&preset, &sorted, &sorted_values, &table](std::size_t) {
+        preset.values_at(sorted, sorted_values, table);
+        do_not_optimize(sorted_values.data());
+    }) / index_count };
+    const double unsorted_ns { nanoseconds_per_op(repetitions, [&preset, &unsorted, &unsorted_values, &table](std::size_t) {
+        preset.values_at(unsorted, unsorted_values, table);
+        do_not_optimize(unsorted_values.data());
+    }) / index_count };
+    const double untabled_ns { nanoseconds_per_op(repetitions, [&preset, &unsorted, &unsorted_values](std::size_t) {
+        preset.values_at(unsorted, unsorted_values);
+        do_not_optimize(unsorted_values.data());
+    }) / index_count };
+    const double parallel_ns { nanoseconds_per_op(repetitions, [&preset, &unsorted, &parallel_values, &table](std::size_t) {
+        parallel_values_at<T>(preset, unsorted, parallel_values, table);
+        do_not_optimize(parallel_values.data());
+    }) / index_count };
+    // The whole cost of the table that `values_at` without a table builds, not per index.
+    const double build_ns { nanoseconds_per_op(repetitions * 20, [&preset](std::size_t i) {
+        const LCGJumpTable<T, 4> built { preset.affine() };
+        do_not_optimize(built.power(i % LCGJumpTable<T, 4>::digit_count, 1));
+    }) };
+
+    bool same { unsorted_values == expected && parallel_values == expected };
+    for (std::size_t i { 0 }; i != index_count; ++i) {
+        same = same && sorted_values[i] == preset.value_after_n_steps(sorted[i]);
+    }
+    record(name, { { "each", each_ns }, { "sorted", sorted_ns }, { "unsorted", unsorted_ns }, { "no table", untabled_ns }, { "parallel", parallel_ns }, { "build", build_ns } });
+    std::printf("%-16.*s %10.1f %10.1f %10.1f %10.1f %10.1f %8.2fx %10.0f%s\n",
+        static_cast<int>(name.size()), name.data(),
+        each_ns, sorted_ns, unsorted_ns, untabled_ns, parallel_ns, each_ns / unsorted_ns, build_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_values_ats() -> void
+{
+    std::printf("# Random access: value_after_n_steps per index against values_at, %d indices (ns/index; build: ns per radix-16 table)\n", 1 << 12);
+    std::printf("%-16s %10s %10s %10s %10s %10s %9s %10s\n", "preset", "each", "sorted", "unsorted", "no table", "parallel", "speedup", "build");
+    bench_values_at("krc_rand", krc_rand_engine);
+    bench_values_at("minstd_rand", minstd_rand_engine);
+    bench_values_at("posix_rand48", posix_rand48_engine);
+    bench_values_at("musl_rand", musl_rand_engine);
+    bench_values_at("barrett_1e18+3", LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U });
+}
+
+// Jumping a preset by composing powers at run time, through its compile-time table passed to `LCGEngine`, as the
+// preset itself, which goes through the table on its own, and as a static engine.
+template <std::unsigned_integral T, T a, T c, T m>
+auto bench_preset_jump(std::string_view name, const PresetLCGEngine<T, a, c, m>& preset, StaticLCGEngine<T, a, c, m> static_engine) -> void
+{
+    const LCGEngine<T> engine { preset.to_dynamic() };
+    const LCGJumpTable<T, 4>& table { static_engine.jump_table() };
+    const double powered_ns { nanoseconds_per_op(powered_iterations, [&engine](std::size_t i) {
+        do_not_optimize(engine.value_after_n_steps(jump_distance(i)));
+    }) };
+    const double table_ns { nanoseconds_per_op(powered_iterations, [&engine, &table](std::size_t i) {
+        do_not_optimize(engine.value_after_n_steps(jump_distance(i), table));
+    }) };
+    const double preset_ns { nanoseconds_per_op(powered_iterations, [&preset](std::size_t i) {
+        do_not_optimize(preset.value_after_n_steps(jump_distance(i)));
+    }) };
+    const double static_ns { nanoseconds_per_op(powered_iterations, [&static_engine](std::size_t i) {
+        do_not_optimize(static_engine.value_after_n_steps(jump_distance(i)));
+    }) };
+
+    bool same { true };
+    for (std::size_t i { 0 }; i != 1000; ++i) {
+        const T expected { engine.value_after_n_steps(jump_distance(i)) };
+        same = same && engine.value_after_n_steps(jump_distance(i), table) == expected && preset.value_after_n_steps(jump_distance(i)) == expected
+            && static_engine.value_after_n_steps(jump_distance(i)) == expected;
+    }
+    record(name, { { "powered", powered_ns }, { "table", table_ns }, { "preset", preset_ns }, { "static", static_ns } });
+    std::printf("%-16.*s %10.1f %10.1f %10.1f %10.1f %8.2fx%s\n",
+        static_cast<int>(name.size()), name.data(), powered_ns, table_ns, preset_ns, static_ns, powered_ns / preset_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_preset_jumps() -> void
+{
+    std::printf("# Preset jumps: value_after_n_steps on LCGEngine without and with the compile-time table, on the preset, and on the static engine (ns/op)\n");
+    std::printf("%-16s %10s %10s %10s %10s %9s\n", "preset", "powered", "table", "preset", "static", "speedup");
+    bench_preset_jump("krc_rand", krc_rand_engine, krc_rand_static_engine);
+    bench_preset_jump("minstd_rand", minstd_rand_engine, minstd_rand_static_engine);
+    bench_preset_jump("minstd_rand0", minstd_rand0_engine, minstd_rand0_static_engine);
+    bench_preset_jump("msvc_rand", msvc_rand_engine, msvc_rand_static_engine);
+    bench_preset_jump("posix_rand48", posix_rand48_engine, posix_rand48_static_engine);
+    bench_preset_jump("musl_rand", musl_rand_engine, musl_rand_static_engine);
+}
+
+template <std::unsigned_integral T>
+auto bench_segment(std::string_view name, const LCGEngine<T>& preset) -> void
+{
+    constexpr std::size_t segment_count { 1 << 12 };
+    constexpr std::size_t repetitions { 20 };
+    constexpr std::size_t query_count { 1 << 12 };
+    std::vector<LCGSegment<T>> segments {};
+    for (std::size_t i { 0 }; i != segment_count; ++i) {
+        const LCGAffineTransform<T> affine { static_cast<T>(preset.a() + (4 * i)), static_cast<T>(preset.c() + i), preset.m() };
+        segments.push_back(LCGSegment<T> { affine, 1000 + ((i * 0x9e37'79b9ULL) % 100000) });
+    }
+    LCGSegmentTree<T> tree { segments };
+    const unsigned long long total { tree.total_steps() };
+    const T seed { preset.state() };
+
+    // Replaying up to a step near the end visits every segment, with one `discard` each.
+    T replayed {};
+    const double replay_ns { nanoseconds_per_op(repetitions, [&segments, &replayed, seed, total](std::size_t i) {
+        unsigned long long steps { total - i };
+        LCGEngine<T> engine { segments.front().affine, seed };
+        for (const LCGSegment<T>& segment : segments) {
+            engine.set_affine(segment.affine);
+            engine.discard(std::min(steps, segment.count));
+            steps -= std::min(steps, segment.count);
+        }
+        replayed = engine.state();
+        do_not_optimize(replayed);
+    }) };
+    const double query_ns { nanoseconds_per_op(query_count, [&tree, seed, total](std::size_t i) {
+        do_not_optimize(tree.value_after_n_steps(seed, (i * 0x9e37'79b9'7f4a'7c15ULL) % total));
+    }) };
+    const double set_ns { nanoseconds_per_op(query_count, [&tree, &segments](std::size_t i) {
+        const std::size_t k { (i * 2654435761U) % segment_count };
+        tree.set(k, segments[k]);
+    }) };
+    std::vector<LCGAffineTransform<T>> serial_prefixes(segment_count, preset.affine());
+    std::vector<LCGAffineTransform<T>> parallel_prefixes(segment_count, preset.affine());
+    const double scan_ns { nanoseconds_per_op(repetitions, [&segments, &serial_prefixes](std::size_t) {
+        prefix_compositions<T>(segments, serial_prefixes);
+        do_not_optimize(serial_prefixes.data());
+    }) / segment_count };
+    const double parallel_scan_ns { nanoseconds_per_op(repetitions, [&segments, &parallel_prefixes](std::size_t) {
+        parallel_prefix_compositions<T>(segments, parallel_prefixes);
+        do_not_optimize(parallel_prefixes.data());
+    }) / segment_count };
+
+    const bool same { replayed == tree.value_after_n_steps(seed, total - (repetitions - 1))
+        && serial_prefixes == parallel_prefixes && serial_prefixes.back() == tree.composed() };
+    record(name, { { "replay", replay_ns }, { "tree", query_ns }, { "set", set_ns }, { "scan", scan_ns }, { "parallel", parallel_scan_ns } });
+    std::printf("%-16.*s %10.1f %10.1f %10.1f %10.1f %10.1f%s\n",
+        static_cast<int>(name.size()), name.data(), replay_ns, query_ns, set_ns, scan_ns, parallel_scan_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_segments() -> void
+{
+    std::printf("# Segments: state after t steps of %d segments by replaying against LCGSegmentTree (ns/op), and prefix scans (ns/segment)\n", 1 << 12);
+    std::printf("%-16s %10s %10s %10s %10s %10s\n", "preset", "replay", "tree", "set", "scan", "parallel");
+    bench_segment("krc_rand", krc_rand_engine);
+    bench_segment("minstd_rand", minstd_rand_engine);
+    bench_segment("posix_rand48", posix_rand48_engine);
+    bench_segment("musl_rand", musl_rand_engine);
+}
+
+// Building an index of the presets, opening it from a file, and finding (preset, offset) from 3 outputs.
+auto bench_fingerprints() -> void
+{
+    constexpr std::uint64_t baby_steps { 1 << 18 };
+    constexpr std::uint64_t giant_steps { 1 << 14 };
+    constexpr std::size_t query_count { 64 };
+    const std::filesystem::path path { std::filesystem::temp_directory_path() / "lcg_predict_bench_fingerprint.idx" };
+
+    std::printf("# Fingerprint index: %zu presets, offsets below 2^32; build and write (ms), open (us), find from 3 outputs (us/op)\n", fingerprint_presets.size());
+    std::printf("%-16s %10s %10s %10s %10s\n", "file MiB", "build", "open", "find", "found");
+    std::vector<std::uint64_t> words {};
+    const double build_ns { nanoseconds_per_op(1, [&words, &path](std::size_t) {
+        words = build_fingerprint_index(fingerprint_presets, baby_steps, giant_steps);
+        do_not_optimize(write_fingerprint_index(path, words));
+    }) };
+    std::optional<MappedFingerprintIndex> index {};
+    const double open_ns { nanoseconds_per_op(1, [&index, &path](std::size_t) {
+        index = MappedFingerprintIndex::open(path);
+    }) };
+    if (!index.has_value()) {
+        std::printf("cannot open %s\n", path.c_str());
+        return;
+    }
+
+    std::size_t found { 0 };
+    const double find_ns { nanoseconds_per_op(query_count, [&index, &found](std::size_t i) {
+        const std::size_t preset { i % fingerprint_presets.size() };
+        const FingerprintSource& source { fingerprint_presets[preset] };
+        // Below the periods of 2^31 - 2 and 2^31, after which the first offset is found instead.
+        const unsigned long long offset { jump_distance(i) >> 34U };
+        std::array<std::uint64_t, 3> outputs {};
+        std::uint64_t state { source.affine.powered(offset)(source.seed) };
+        for (std::uint64_t& output : outputs) {
+            state = source.affine(state);
+            output = source.projection(state);
+        }
+        const std::vector<FingerprintMatch> matches { index->find(outputs) };
+        found += static_cast<std::size_t>(std::ranges::count(matches, FingerprintMatch { preset, offset }));
+    }) };
+    record("presets", { { "bytes", static_cast<double>(words.size() * sizeof(std::uint64_t)) }, { "build", build_ns }, { "open", open_ns }, { "find", find_ns } });
+    std::printf("%-16.1f %10.1f %10.1f %10.1f %7zu/%zu\n",
+        static_cast<double>(words.size() * sizeof(std::uint64_t)) / (1 << 20), build_ns / 1e6, open_ns / 1e3, find_ns / 1e3, found, query_count);
+    std::filesystem::remove(path);
+}
+
+template <typename Engine>
+auto bench_combined(std::string_view name, const Engine& preset) -> void
+{
+    using T = typename Engine::result_type;
+    constexpr std::size_t count { 1 << 20 };
+    constexpr std::size_t repetitions { 20 };
+    constexpr unsigned long long distance { 1 << 20 };
+
+    std::vector<T> buffer(count);
+    Engine engine { preset };
+    const double generate_ns { nanoseconds_per_op(repetitions, [&engine, &buffer](std::size_t) {
+        engine.generate(buffer);
+        do_not_optimize(buffer.data());
+    }) / count };
+    Engine stepped { preset };
+    const double step_ns { nanoseconds_per_op(1, [&stepped](std::size_t) {
+        for (unsigned long long i { 0 }; i != distance; ++i) {
+            do_not_optimize(stepped());
+        }
+    }) };
+    const double jump_ns { nanoseconds_per_op(powered_iterations / 10, [&preset](std::size_t i) {
+        do_not_optimize(preset.value_after_n_steps(jump_distance(i)));
+    }) };
+
+    const bool same { stepped() == preset.value_after_n_steps(distance + 1) };
+    record(name, { { "generate", generate_ns }, { "step 2^20", step_ns }, { "jump", jump_ns } });
+    std::printf("%-16.*s %10.3f %12.0f %10.1f%s\n",
+        static_cast<int>(name.size()), name.data(), generate_ns, step_ns, jump_ns, same ? "" : "  MISMATCH");
+}
+
+auto bench_combineds() -> void
+{
+    std::printf("# Combined generators: generate (ns/value), stepping 2^20 values against one jump (ns/op)\n");
+    std::printf("%-16s %10s %12s %10s\n", "preset", "generate", "step 2^20", "jump");
+    bench_combined("mrg32k3a", mrg32k3a_engine);
+    bench_combined("lecuyer1988", lecuyer1988_engine);
+}
+
+template <std::unsigned_integral T>
+auto bench_seed_search(std::string_view name, ProjectedLCGEngine<T> engine, std::size_t thread_count) -> void
+{
+    constexpr unsigned long long seed_count { 1ULL << 26 };
+    constexpr unsigned long long seed { seed_count - 12345 };
+    engine.set_state(static_cast<T>(seed));
+    const SeedSearch<T> search { engine.engine().affine(), engine.projection(), { engine(), engine(), engine() } };
+
+    std::vector<unsigned long long> found {};
+    const double ns { nanoseconds_per_op(1, [&search, &found, thread_count](std::size_t) {
+        found = search.find_all(0, seed_count, thread_count);
+    }) };
+    const double seeds_per_second { static_cast<double>(seed_count) / ns * 1e9 };
+    record(std::string { name } + "/" + std::to_string(thread_count), { { "seeds/s", seeds_per_second } });
+    std::printf("%-16.*s %8zu %14.3e%s\n", static_cast<int>(name.size()), name.data(), thread_count, seeds_per_second,
+        std::ranges::find(found, seed) != found.end() ? "" : "  MISSED");
+}
+
+auto bench_seed_searches() -> void
+{
+    const std::size_t max_threads { std::max(std::thread::hardware_concurrency(), 1U) };
+    std::printf("# Seed search over 2^26 seeds for 3 outputs\n");
+    std::printf("%-16s %8s %14s\n", "preset", "threads", "seeds/s");
+    std::vector<std::size_t> thread_counts { 1 };
+    if (max_threads != 1) {
+        thread_counts.push_back(max_threads);
+    }
+    for (const std::size_t threads : thread_counts) {
+        bench_seed_search("krc_rand", krc_rand_output_engine, threads);
+        bench_seed_search("minstd_rand", minstd_rand_output_engine, threads);
+        bench_seed_search("msvc_rand", msvc_rand_output_engine, threads);
+        bench_seed_search("posix_lrand48", posix_lrand48_output_engine, threads);
+        bench_seed_search("musl_rand", musl_rand_output_engine, threads);
+        bench_seed_search("krc_rand<u32>", ProjectedLCGEngine<std::uint32_t> { LCGEngine<std::uint32_t> { 1103515245, 12345, 2147483648 }, LCGProjection<std::uint32_t> { 16, 15 } }, threads);
+    }
+}
+
+struct Section {
+    std::string_view id;
+    auto (*run)() -> void;
+};
+
+// The sections, in the order they run, with the names that select them on the command line.
+constexpr inline std::array sections {
+    Section { "reduction", bench_reductions },
+#if defined(__SIZEOF_INT128__)
+    Section { "doubled", bench_doubleds },
+    Section { "wide", bench_wides },
+#endif
+    Section { "std", bench_stds },
+    Section { "latency", bench_latencies },
+    Section { "period", bench_periods },
+    Section { "generation", bench_generations },
+    Section { "sequence", bench_sequences },
+    Section { "sum", bench_sums },
+    Section { "parallel", bench_parallel_generations },
+    Section { "pool", bench_pools },
+    Section { "values_at", bench_values_ats },
+    Section { "preset_jump", bench_preset_jumps },
+    Section { "segments", bench_segments },
+    Section { "fingerprint", bench_fingerprints },
+    Section { "combined", bench_combineds },
+    Section { "seed_search", bench_seed_searches },
+};
+
+}
+
+// Usage: lcg_predict_bench [--csv <path>] [section ...]
+// Runs the given sections, or all of them, and with `--csv`, also writes every measured value to `path`.
+auto main(int argc, char** argv) -> int
+{
+    const std::span<char*> args { argv + 1, static_cast<std::size_t>(argc - 1) };
+    std::optional<std::filesystem::path> csv_path {};
+    std::vector<std::string_view> selected {};
+    for (std::size_t i { 0 }; i != args.size(); ++i) {
+        const std::string_view arg { args[i] };
+        if (arg == "--csv" && i + 1 != args.size()) {
+            csv_path = args[++i];
+        } else if (std::ranges::find(sections, arg, &Section::id) != sections.end()) {
+            selected.push_back(arg);
+        } else {
+            std::fprintf(stderr, "usage: %s [--csv <path>] [section ...]\nsections:", argv[0]);
+            for (const Section& section : sections) {
+                std::fprintf(stderr, " %.*s", static_cast<int>(section.id.size()), section.id.data());
+            }
+            std::fprintf(stderr, "\n");
+            return 2;
+        }
+    }
+
+    cycles_per_nanosecond = measure_cycles_per_nanosecond();
+    current_section = "machine";
+    record("tsc", { { "cycles/ns", cycles_per_nanosecond } });
+    for (const Section& section : sections) {
+        if (selected.empty() || std::ranges::find(selected, section.id) != selected.end()) {
+            current_section = section.id;
+            const LCGCounters before { all_counters() };
+            section.run();
+            if constexpr (counters_enabled) {
+                // Built with `LCG_PREDICT_INSTRUMENT`: the work of the section, including its warm-up runs.
+                std::ostringstream report {};
+                report << (all_counters() - before);
+                std::printf("counters of %.*s:\n%s\n", static_cast<int>(section.id.size()), section.id.data(), report.str().c_str());
+            }
+        }
+    }
+    if (csv_path.has_value() && !write_results(*csv_path)) {
+        std::fprintf(stderr, "cannot write %s\n", csv_path->c_str());
+        return 1;
+    }
+}
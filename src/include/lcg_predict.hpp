@@ -6,431 +6,3702 @@
 #define LCG_PREDICT_HPP_INCLUDED
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <climits>
+#include <compare>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <istream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ostream>
 #include <random>
+#include <ranges>
+#include <span>
 #include <sstream>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+#if defined(LCG_PREDICT_INSTRUMENT)
+#include <atomic>
+#include <mutex>
+#endif
 
 namespace ls_hower::lcg_predict::detail {
 
-template <typename T>
-concept unsigned_integer_like = std::unsigned_integral<T> || std::same_as<T, __uint128_t>;
+// Whether the compiler provides `__uint128_t` and `__int128_t`.
+#if defined(__SIZEOF_INT128__)
+using NativeUInt128 = __uint128_t;
+using NativeInt128 = __int128_t;
+#else
+// Never defined, so that the concepts below match nothing in their place.
+struct NativeUInt128;
+struct NativeInt128;
+#endif
+
+struct WordDivision {
+    unsigned long long quotient;
+    unsigned long long remainder;
+};
 
-template <typename T>
-concept signed_integer_like = std::signed_integral<T> || std::same_as<T, __int128_t>;
+class UnsignedDoubledLongLong;
 
-template <typename T>
-concept integer_like = std::integral<T> || std::same_as<T, __int128_t> || std::same_as<T, __uint128_t>;
+// Returns the 2-word product x * y.
+[[nodiscard]] constexpr auto multiply_words(unsigned long long x, unsigned long long y) noexcept -> UnsignedDoubledLongLong;
 
-template <std::integral T>
-struct least_doubled_uint {
-private:
-    template <unsigned_integer_like Head, unsigned_integer_like... Tail>
-    struct finder {
-        using type = std::conditional_t<
-            sizeof(Head) >= 2 * sizeof(T),
-            Head,
-            typename finder<Tail...>::type>;
-    };
+// Same result as `multiply_words`, computed on 32-bit halves, without `__uint128_t` or intrinsics.
+[[nodiscard]] constexpr auto schoolbook_multiply_words(unsigned long long x, unsigned long long y) noexcept -> UnsignedDoubledLongLong;
 
-    template <unsigned_integer_like Last>
-    struct finder<Last> {
-        using type = Last;
-    };
+// Returns (high * 2^64 + low) / d and the remainder.
+// Require: high < d, so that the quotient fits in one word.
+[[nodiscard]] constexpr auto divide_words(unsigned long long high, unsigned long long low, unsigned long long d) noexcept -> WordDivision;
 
-    template <unsigned_integer_like... Ts>
-    using finder_t = finder<Ts...>::type;
+// Same result as `divide_words`, computed by 32-bit digits, without `__uint128_t` or instructions.
+// Require: high < d.
+[[nodiscard]] constexpr auto long_divide_words(unsigned long long high, unsigned long long low, unsigned long long d) noexcept -> WordDivision;
+
+// Unsigned integer of two `unsigned long long` words, which wraps modulo 2^128 like the built-in unsigned types.
+// It is the double-width type of `UnsignedModder` for 64-bit moduli where the compiler has no `__uint128_t`, which
+// is the default double-width type otherwise, as the compiler evaluates it much faster in constant expressions.
+// Where the compiler has `__uint128_t`, the value is stored in one, and operations use it, so that they compile to
+// the same instructions, and constant evaluation is as fast as with `__uint128_t`. Otherwise, operations work on the
+// two words, with the instructions computing 2-word products and quotients where available. The word-level
+// algorithms are public as the `words_*` functions, so that they are tested against `__uint128_t` where it exists.
+// Conversions from built-in integers are implicit, as between built-in integers; conversions to them are explicit.
+class UnsignedDoubledLongLong {
+    static constexpr int word_digits { std::numeric_limits<unsigned long long>::digits };
+
+#if defined(__SIZEOF_INT128__)
+    __uint128_t value_ { 0 };
+
+    [[nodiscard]] static constexpr auto from_native(__uint128_t x) noexcept -> UnsignedDoubledLongLong
+    {
+        UnsignedDoubledLongLong result {};
+        result.value_ = x;
+        return result;
+    }
+#else
+    unsigned long long high_ { 0 };
+    unsigned long long low_ { 0 };
+
+    // The high word of `x` sign-extended.
+    template <std::integral U>
+    [[nodiscard]] static constexpr auto sign_word(U x) noexcept -> unsigned long long
+    {
+        if constexpr (std::signed_integral<U>) {
+            return x < 0 ? ~0ULL : 0ULL;
+        } else {
+            return 0;
+        }
+    }
+#endif
 
 public:
-    using type = finder_t<
-        unsigned int,
-        unsigned long,
-        unsigned long long,
-        __uint128_t>;
-    static_assert(unsigned_integer_like<type>);
-    static_assert(sizeof(type) >= 2 * sizeof(T));
-};
+    constexpr UnsignedDoubledLongLong() noexcept = default;
 
-template <std::integral T>
-using least_doubled_uint_t = typename least_doubled_uint<T>::type;
+    // Negative `x` wraps around, as in a conversion between built-in integers.
+    template <std::integral U>
+    constexpr UnsignedDoubledLongLong(U x) noexcept // NOLINT : implicit, as between built-in integers.
+#if defined(__SIZEOF_INT128__)
+        : value_ { static_cast<__uint128_t>(x) }
+    {
+    }
+#else
+    {
+        *this = from_words(sign_word(x), static_cast<unsigned long long>(x));
+    }
+#endif
 
-template <std::integral T>
-struct least_doubled_int {
-private:
-    using UnsignedBigger = least_doubled_uint_t<T>;
+#if defined(__SIZEOF_INT128__)
+    constexpr UnsignedDoubledLongLong(__uint128_t x) noexcept // NOLINT : implicit, as between built-in integers.
+        : value_ { x }
+    {
+    }
+#endif
 
-    template <typename>
-    struct signed_chooser;
+    [[nodiscard]] static constexpr auto from_words(unsigned long long high, unsigned long long low) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native((static_cast<__uint128_t>(high) << word_digits) | low);
+#else
+        UnsignedDoubledLongLong result {};
+        result.high_ = high;
+        result.low_ = low;
+        return result;
+#endif
+    }
 
-    template <typename U>
-        requires (std::same_as<U, __uint128_t> || std::same_as<U, __int128_t>)
-    struct signed_chooser<U> {
-        using type = __int128_t;
-    };
+    [[nodiscard]] constexpr auto high() const noexcept -> unsigned long long
+    {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<unsigned long long>(value_ >> word_digits);
+#else
+        return high_;
+#endif
+    }
+
+    [[nodiscard]] constexpr auto low() const noexcept -> unsigned long long
+    {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<unsigned long long>(value_);
+#else
+        return low_;
+#endif
+    }
 
     template <std::integral U>
-    struct signed_chooser<U> {
-        using type = std::make_signed_t<U>;
+    [[nodiscard]] explicit constexpr operator U() const noexcept
+    {
+        if constexpr (std::same_as<U, bool>) {
+            return (this->high() | this->low()) != 0;
+        } else {
+            return static_cast<U>(this->low());
+        }
+    }
+
+#if defined(__SIZEOF_INT128__)
+    [[nodiscard]] explicit constexpr operator __uint128_t() const noexcept { return value_; }
+#endif
+
+    // Either way, the high word is compared first.
+    [[nodiscard]] friend constexpr auto operator==(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> bool = default;
+    [[nodiscard]] friend constexpr auto operator<=>(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> std::strong_ordering = default;
+
+    [[nodiscard]] friend constexpr auto operator~(const UnsignedDoubledLongLong& x) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(~x.value_);
+#else
+        return from_words(~x.high(), ~x.low());
+#endif
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const UnsignedDoubledLongLong& x) noexcept -> UnsignedDoubledLongLong
+    {
+        return UnsignedDoubledLongLong {} - x;
+    }
+
+    [[nodiscard]] static constexpr auto words_plus(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+        const unsigned long long low { lhs.low() + rhs.low() };
+        return from_words(lhs.high() + rhs.high() + (low < lhs.low() ? 1U : 0U), low);
+    }
+
+    [[nodiscard]] static constexpr auto words_minus(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+        return from_words(lhs.high() - rhs.high() - (lhs.low() < rhs.low() ? 1U : 0U), lhs.low() - rhs.low());
+    }
+
+    [[nodiscard]] static constexpr auto words_times(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+        // The cross terms only reach the high word. When both high words are known to be 0, they fold away.
+        const UnsignedDoubledLongLong low_product { multiply_words(lhs.low(), rhs.low()) };
+        return from_words(low_product.high() + (lhs.low() * rhs.high()) + (lhs.high() * rhs.low()), low_product.low());
+    }
+
+    // Require: n < 128.
+    [[nodiscard]] static constexpr auto words_shifted_left(const UnsignedDoubledLongLong& x, unsigned n) noexcept -> UnsignedDoubledLongLong
+    {
+        assert(n < 2 * word_digits);
+        if (n >= word_digits) {
+            return from_words(x.low() << (n - word_digits), 0);
+        }
+        // Two shifts instead of one by (word_digits - n), which is undefined for n == 0.
+        return from_words((x.high() << n) | ((x.low() >> 1U) >> (word_digits - 1 - n)), x.low() << n);
+    }
+
+    // Require: n < 128.
+    [[nodiscard]] static constexpr auto words_shifted_right(const UnsignedDoubledLongLong& x, unsigned n) noexcept -> UnsignedDoubledLongLong
+    {
+        assert(n < 2 * word_digits);
+        if (n >= word_digits) {
+            return from_words(0, x.high() >> (n - word_digits));
+        }
+        return from_words(x.high() >> n, (x.low() >> n) | ((x.high() << 1U) << (word_digits - 1 - n)));
+    }
+
+    // Returns the quotient and the remainder, rounded towards 0.
+    // Require: rhs != 0.
+    [[nodiscard]] static constexpr auto words_divide(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> std::pair<UnsignedDoubledLongLong, UnsignedDoubledLongLong>
+    {
+        assert(rhs != 0);
+        if (rhs.high() == 0) {
+            const unsigned long long d { rhs.low() };
+            if (lhs.high() < d) {
+                const auto [quotient, remainder] { divide_words(lhs.high(), lhs.low(), d) };
+                return { quotient, remainder };
+            }
+            const auto [quotient, remainder] { divide_words(lhs.high() % d, lhs.low(), d) };
+            return { from_words(lhs.high() / d, quotient), remainder };
+        }
+        // The quotient fits in one word. Estimate it from the top word of the normalized divisor, which is
+        // at most 1 too large after the adjustment below. See: H. S. Warren, Hacker's Delight, 2nd ed., 9-5.
+        const auto n { static_cast<unsigned>(std::countl_zero(rhs.high())) };
+        const unsigned long long v1 { (rhs << n).high() };
+        const UnsignedDoubledLongLong u1 { lhs >> 1U };
+        const unsigned long long q1 { divide_words(u1.high(), u1.low(), v1).quotient };
+        auto quotient { static_cast<unsigned long long>((UnsignedDoubledLongLong { q1 } << n) >> static_cast<unsigned>(word_digits - 1)) };
+        if (quotient != 0) {
+            --quotient;
+        }
+        UnsignedDoubledLongLong remainder { lhs - (rhs * quotient) };
+        if (remainder >= rhs) {
+            ++quotient;
+            remainder -= rhs;
+        }
+        return { quotient, remainder };
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ + rhs.value_);
+#else
+        return words_plus(lhs, rhs);
+#endif
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ - rhs.value_);
+#else
+        return words_minus(lhs, rhs);
+#endif
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ * rhs.value_);
+#else
+        return words_times(lhs, rhs);
+#endif
+    }
+
+    // Returns the quotient and the remainder, rounded towards 0.
+    // A `__uint128_t` division is a library call, so it is only used during constant evaluation.
+    // Require: rhs != 0.
+    [[nodiscard]] friend constexpr auto divide(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> std::pair<UnsignedDoubledLongLong, UnsignedDoubledLongLong>
+    {
+#if defined(__SIZEOF_INT128__)
+        if (std::is_constant_evaluated()) {
+            assert(rhs != 0);
+            return { from_native(lhs.value_ / rhs.value_), from_native(lhs.value_ % rhs.value_) };
+        }
+#endif
+        return words_divide(lhs, rhs);
+    }
+
+    // The common case of a one-word quotient by a one-word divisor is one instruction, kept out of `divide`.
+    // Outside constant evaluation, it replaces the library call for a `__uint128_t` division.
+    [[nodiscard]] friend constexpr auto operator/(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+        if (rhs.high() == 0 && lhs.high() < rhs.low()) {
+            return divide_words(lhs.high(), lhs.low(), rhs.low()).quotient;
+        }
+        return divide(lhs, rhs).first;
+    }
+
+    [[nodiscard]] friend constexpr auto operator%(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+        if (rhs.high() == 0 && lhs.high() < rhs.low()) {
+            return divide_words(lhs.high(), lhs.low(), rhs.low()).remainder;
+        }
+        return divide(lhs, rhs).second;
+    }
+
+    [[nodiscard]] friend constexpr auto operator&(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ & rhs.value_);
+#else
+        return from_words(lhs.high() & rhs.high(), lhs.low() & rhs.low());
+#endif
+    }
+
+    [[nodiscard]] friend constexpr auto operator|(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ | rhs.value_);
+#else
+        return from_words(lhs.high() | rhs.high(), lhs.low() | rhs.low());
+#endif
+    }
+
+    [[nodiscard]] friend constexpr auto operator^(const UnsignedDoubledLongLong& lhs, const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        return from_native(lhs.value_ ^ rhs.value_);
+#else
+        return from_words(lhs.high() ^ rhs.high(), lhs.low() ^ rhs.low());
+#endif
+    }
+
+    // Require: n < 128, as for the built-in types.
+    [[nodiscard]] friend constexpr auto operator<<(const UnsignedDoubledLongLong& x, unsigned n) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        assert(n < 2 * word_digits);
+        return from_native(x.value_ << n);
+#else
+        return words_shifted_left(x, n);
+#endif
+    }
+
+    // Require: n < 128, as for the built-in types.
+    [[nodiscard]] friend constexpr auto operator>>(const UnsignedDoubledLongLong& x, unsigned n) noexcept -> UnsignedDoubledLongLong
+    {
+#if defined(__SIZEOF_INT128__)
+        assert(n < 2 * word_digits);
+        return from_native(x.value_ >> n);
+#else
+        return words_shifted_right(x, n);
+#endif
+    }
+
+    constexpr auto operator+=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this + rhs; }
+    constexpr auto operator-=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this - rhs; }
+    constexpr auto operator*=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this * rhs; }
+    constexpr auto operator/=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this / rhs; }
+    constexpr auto operator%=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this % rhs; }
+    constexpr auto operator&=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this & rhs; }
+    constexpr auto operator|=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this | rhs; }
+    constexpr auto operator^=(const UnsignedDoubledLongLong& rhs) noexcept -> UnsignedDoubledLongLong& { return *this = *this ^ rhs; }
+    constexpr auto operator<<=(unsigned n) noexcept -> UnsignedDoubledLongLong& { return *this = *this << n; }
+    constexpr auto operator>>=(unsigned n) noexcept -> UnsignedDoubledLongLong& { return *this = *this >> n; }
+};
+
+[[nodiscard]] constexpr auto multiply_words(unsigned long long x, unsigned long long y) noexcept -> UnsignedDoubledLongLong
+{
+#if defined(__SIZEOF_INT128__)
+    // GCC and Clang compile this to one `mul` (or `mulx` with BMI2) on x86-64, and `mul` and `umulh` on AArch64.
+    return static_cast<__uint128_t>(x) * y;
+#else
+    if (!std::is_constant_evaluated()) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long long high {};
+        const unsigned long long low { _umul128(x, y, &high) };
+        return UnsignedDoubledLongLong::from_words(high, low);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        return UnsignedDoubledLongLong::from_words(__umulh(x, y), x * y);
+#endif
+    }
+    return schoolbook_multiply_words(x, y);
+#endif
+}
+
+[[nodiscard]] constexpr auto schoolbook_multiply_words(unsigned long long x, unsigned long long y) noexcept -> UnsignedDoubledLongLong
+{
+    constexpr unsigned long long half_mask { 0xffff'ffffULL };
+    const unsigned long long x0 { x & half_mask };
+    const unsigned long long x1 { x >> 32U };
+    const unsigned long long y0 { y & half_mask };
+    const unsigned long long y1 { y >> 32U };
+    const unsigned long long p00 { x0 * y0 };
+    const unsigned long long p01 { x0 * y1 };
+    const unsigned long long p10 { x1 * y0 };
+    const unsigned long long p11 { x1 * y1 };
+    // Below 3 * 2^32, so it does not overflow.
+    const unsigned long long middle { (p00 >> 32U) + (p01 & half_mask) + (p10 & half_mask) };
+    return UnsignedDoubledLongLong::from_words(p11 + (p01 >> 32U) + (p10 >> 32U) + (middle >> 32U), (middle << 32U) | (p00 & half_mask));
+}
+
+[[nodiscard]] constexpr auto divide_words(unsigned long long high, unsigned long long low, unsigned long long d) noexcept -> WordDivision
+{
+    assert(high < d);
+    if (!std::is_constant_evaluated()) {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        WordDivision result {};
+        asm("divq %[d]" : "=a"(result.quotient), "=d"(result.remainder) : [d] "r"(d), "a"(low), "d"(high));
+        return result;
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+        WordDivision result {};
+        result.quotient = _udiv128(high, low, d, &result.remainder);
+        return result;
+#endif
+    }
+#if defined(__SIZEOF_INT128__)
+    if (std::is_constant_evaluated()) {
+        const __uint128_t dividend { (static_cast<__uint128_t>(high) << 64U) | low };
+        return { static_cast<unsigned long long>(dividend / d), static_cast<unsigned long long>(dividend % d) };
+    }
+#endif
+    return long_divide_words(high, low, d);
+}
+
+[[nodiscard]] constexpr auto long_divide_words(unsigned long long high, unsigned long long low, unsigned long long d) noexcept -> WordDivision
+{
+    assert(high < d);
+    // Long division by 32-bit digits. See: H. S. Warren, Hacker's Delight, 2nd ed., 9-4 (`divlu`).
+    constexpr unsigned long long base { 1ULL << 32U };
+    constexpr unsigned long long half_mask { base - 1 };
+    const auto s { static_cast<unsigned>(std::countl_zero(d)) };
+    d <<= s;
+    const unsigned long long d1 { d >> 32U };
+    const unsigned long long d0 { d & half_mask };
+    const unsigned long long u32 { s == 0 ? high : (high << s) | (low >> (64U - s)) };
+    const unsigned long long u10 { low << s };
+    const unsigned long long u1 { u10 >> 32U };
+    const unsigned long long u0 { u10 & half_mask };
+
+    // Each estimated digit is at most 2 too large.
+    const auto next_digit {
+        [d1, d0](unsigned long long top, unsigned long long next) noexcept -> unsigned long long {
+            unsigned long long q { top / d1 };
+            unsigned long long r { top - (q * d1) };
+            while (q >= base || q * d0 > (base * r) + next) {
+                --q;
+                r += d1;
+                if (r >= base) {
+                    break;
+                }
+            }
+            return q;
+        }
     };
+    const unsigned long long q1 { next_digit(u32, u1) };
+    // Wrapping is intended: the true value is below d.
+    const unsigned long long u21 { (u32 * base) + u1 - (q1 * d) };
+    const unsigned long long q0 { next_digit(u21, u0) };
+    return { (q1 * base) + q0, ((u21 * base) + u0 - (q0 * d)) >> s };
+}
+
+// Signed integer of two words in two's complement, which wraps like `UnsignedDoubledLongLong`.
+// Division rounds towards 0, as for the built-in signed types.
+class DoubledLongLong {
+    UnsignedDoubledLongLong bits_ {};
+
+    [[nodiscard]] constexpr auto is_negative() const noexcept -> bool
+    {
+        return (bits_.high() >> (std::numeric_limits<unsigned long long>::digits - 1)) != 0;
+    }
+
+    [[nodiscard]] constexpr auto magnitude() const noexcept -> UnsignedDoubledLongLong
+    {
+        return this->is_negative() ? -bits_ : bits_;
+    }
+
+    [[nodiscard]] static constexpr auto from_bits(const UnsignedDoubledLongLong& bits) noexcept -> DoubledLongLong
+    {
+        DoubledLongLong result {};
+        result.bits_ = bits;
+        return result;
+    }
 
 public:
-    using type = signed_chooser<UnsignedBigger>::type;
-    static_assert(signed_integer_like<type>);
-    static_assert(sizeof(type) >= 2 * sizeof(T));
+    constexpr DoubledLongLong() noexcept = default;
+
+    template <std::integral U>
+    constexpr DoubledLongLong(U x) noexcept // NOLINT : implicit, as between built-in integers.
+        : bits_ { x }
+    {
+    }
+
+    explicit constexpr DoubledLongLong(const UnsignedDoubledLongLong& x) noexcept
+        : bits_ { x }
+    {
+    }
+
+    [[nodiscard]] explicit constexpr operator UnsignedDoubledLongLong() const noexcept { return bits_; }
+
+    template <std::integral U>
+    [[nodiscard]] explicit constexpr operator U() const noexcept { return static_cast<U>(bits_); }
+
+    [[nodiscard]] friend constexpr auto operator==(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> bool = default;
+
+    [[nodiscard]] friend constexpr auto operator<=>(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> std::strong_ordering
+    {
+        if (lhs.is_negative() != rhs.is_negative()) {
+            return lhs.is_negative() ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        // With the same sign, two's complement orders like the unsigned bits.
+        return lhs.bits_ <=> rhs.bits_;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const DoubledLongLong& x) noexcept -> DoubledLongLong { return from_bits(-x.bits_); }
+
+    [[nodiscard]] friend constexpr auto operator+(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> DoubledLongLong
+    {
+        return from_bits(lhs.bits_ + rhs.bits_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> DoubledLongLong
+    {
+        return from_bits(lhs.bits_ - rhs.bits_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> DoubledLongLong
+    {
+        return from_bits(lhs.bits_ * rhs.bits_);
+    }
+
+    // Require: rhs != 0.
+    [[nodiscard]] friend constexpr auto operator/(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> DoubledLongLong
+    {
+        const UnsignedDoubledLongLong quotient { lhs.magnitude() / rhs.magnitude() };
+        return from_bits(lhs.is_negative() != rhs.is_negative() ? -quotient : quotient);
+    }
+
+    // Has the sign of `lhs`. Require: rhs != 0.
+    [[nodiscard]] friend constexpr auto operator%(const DoubledLongLong& lhs, const DoubledLongLong& rhs) noexcept -> DoubledLongLong
+    {
+        const UnsignedDoubledLongLong remainder { lhs.magnitude() % rhs.magnitude() };
+        return from_bits(lhs.is_negative() ? -remainder : remainder);
+    }
+
+    constexpr auto operator+=(const DoubledLongLong& rhs) noexcept -> DoubledLongLong& { return *this = *this + rhs; }
+    constexpr auto operator-=(const DoubledLongLong& rhs) noexcept -> DoubledLongLong& { return *this = *this - rhs; }
+    constexpr auto operator*=(const DoubledLongLong& rhs) noexcept -> DoubledLongLong& { return *this = *this * rhs; }
+    constexpr auto operator/=(const DoubledLongLong& rhs) noexcept -> DoubledLongLong& { return *this = *this / rhs; }
+    constexpr auto operator%=(const DoubledLongLong& rhs) noexcept -> DoubledLongLong& { return *this = *this % rhs; }
 };
 
-template <std::integral T>
-using least_doubled_int_t = typename least_doubled_int<T>::type;
+template <typename Word>
+class UnsignedDoubled;
+
+// The members of `std::numeric_limits` shared by the integer classes here, which all wrap around.
+template <int Digits, bool Signed>
+struct WrappingIntegerLimits {
+    static constexpr bool is_specialized { true };
+    static constexpr bool is_signed { Signed };
+    static constexpr bool is_integer { true };
+    static constexpr bool is_exact { true };
+    static constexpr bool is_bounded { true };
+    static constexpr bool is_modulo { true };
+    static constexpr int radix { 2 };
+    static constexpr int digits { Digits };
+    static constexpr int digits10 { Digits * 643 / 2136 };
+};
 
-template <typename Op, typename T>
-concept BinaryClosure = requires(Op op, T x, T y) {
-    { op(x, y) } -> std::convertible_to<T>;
+} // namespace ls_hower::lcg_predict::detail
+
+template <>
+struct std::numeric_limits<ls_hower::lcg_predict::detail::UnsignedDoubledLongLong>
+    : ls_hower::lcg_predict::detail::WrappingIntegerLimits<2 * std::numeric_limits<unsigned long long>::digits, false> {
+    using type = ls_hower::lcg_predict::detail::UnsignedDoubledLongLong;
+    [[nodiscard]] static constexpr auto min() noexcept -> type { return type {}; }
+    [[nodiscard]] static constexpr auto lowest() noexcept -> type { return type {}; }
+    [[nodiscard]] static constexpr auto max() noexcept -> type { return ~type {}; }
 };
 
-// Generalized fast pow algorithm.
-// Require: `op` be associative.
-// Require: `unit` be the identity for `op`.
-// Returns: (elem op elem op ... op elem). There are `n` `elem`'s. If `n` == 0, returns `unit`.
-template <typename T, typename Op>
-[[nodiscard]] constexpr auto double_and_add(const T& elem, unsigned long long n, const Op& op, const T& unit) -> T
-    requires BinaryClosure<std::remove_cvref_t<Op>, std::remove_cvref_t<T>>
+template <>
+struct std::numeric_limits<ls_hower::lcg_predict::detail::DoubledLongLong>
+    : ls_hower::lcg_predict::detail::WrappingIntegerLimits<(2 * std::numeric_limits<unsigned long long>::digits) - 1, true> {
+    using type = ls_hower::lcg_predict::detail::DoubledLongLong;
+    using unsigned_type = ls_hower::lcg_predict::detail::UnsignedDoubledLongLong;
+    [[nodiscard]] static constexpr auto min() noexcept -> type { return type { unsigned_type { 1U } << digits }; }
+    [[nodiscard]] static constexpr auto lowest() noexcept -> type { return min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> type { return type { ~unsigned_type {} >> 1U }; }
+};
+
+template <typename Word>
+struct std::numeric_limits<ls_hower::lcg_predict::detail::UnsignedDoubled<Word>>
+    : ls_hower::lcg_predict::detail::WrappingIntegerLimits<2 * std::numeric_limits<Word>::digits, false> {
+    using type = ls_hower::lcg_predict::detail::UnsignedDoubled<Word>;
+    [[nodiscard]] static constexpr auto min() noexcept -> type { return type {}; }
+    [[nodiscard]] static constexpr auto lowest() noexcept -> type { return type {}; }
+    [[nodiscard]] static constexpr auto max() noexcept -> type { return ~type {}; }
+};
+
+namespace ls_hower::lcg_predict::detail {
+
+template <typename T>
+struct is_unsigned_doubled : std::false_type { };
+
+template <typename Word>
+struct is_unsigned_doubled<UnsignedDoubled<Word>> : std::true_type { };
+
+template <typename T>
+concept unsigned_integer_like = std::unsigned_integral<T> || std::same_as<T, NativeUInt128> || std::same_as<T, UnsignedDoubledLongLong> || is_unsigned_doubled<T>::value;
+
+template <typename T>
+concept signed_integer_like = std::signed_integral<T> || std::same_as<T, NativeInt128> || std::same_as<T, DoubledLongLong>;
+
+template <typename T>
+concept integer_like = std::integral<T> || unsigned_integer_like<T> || signed_integer_like<T>;
+
+// Unsigned integers wider than `unsigned long long`, e.g. step counts for periods of up to 2^128.
+template <typename T>
+concept wide_unsigned_integer_like = unsigned_integer_like<T> && (sizeof(T) > sizeof(unsigned long long));
+
+// `std::countl_zero`, also for the unsigned types that are not built-in integers.
+template <unsigned_integer_like T>
+[[nodiscard]] constexpr auto countl_zero(const T& x) noexcept -> int
 {
-    std::remove_cvref_t<T> result { unit };
-    std::remove_cvref_t<T> var_elem { elem };
-    for (/* void */; n != 0; n >>= 1U) {
-        if ((n & 1U) != 0) {
-            result = op(std::move(result), var_elem);
+    if constexpr (std::unsigned_integral<T>) {
+        return std::countl_zero(x);
+    } else {
+        constexpr int word_digits { std::numeric_limits<unsigned long long>::digits };
+        int result { 0 };
+        for (int shift { std::numeric_limits<T>::digits - word_digits }; shift >= 0; shift -= word_digits) {
+            if (const auto word { static_cast<unsigned long long>(x >> static_cast<unsigned>(shift)) }; word != 0) {
+                return result + std::countl_zero(word);
+            }
+            result += word_digits;
         }
-        var_elem = op(var_elem, var_elem);
+        return result;
+    }
+}
+
+// `std::countr_zero`, also for the unsigned types that are not built-in integers.
+template <unsigned_integer_like T>
+[[nodiscard]] constexpr auto countr_zero(const T& x) noexcept -> int
+{
+    if constexpr (std::unsigned_integral<T>) {
+        return std::countr_zero(x);
+    } else {
+        constexpr int word_digits { std::numeric_limits<unsigned long long>::digits };
+        for (int shift { 0 }; shift < std::numeric_limits<T>::digits; shift += word_digits) {
+            if (const auto word { static_cast<unsigned long long>(x >> static_cast<unsigned>(shift)) }; word != 0) {
+                return shift + std::countr_zero(word);
+            }
+        }
+        return std::numeric_limits<T>::digits;
+    }
+}
+
+// `std::bit_width`, also for the unsigned types that are not built-in integers.
+template <unsigned_integer_like T>
+[[nodiscard]] constexpr auto bit_width(const T& x) noexcept -> int
+{
+    return std::numeric_limits<T>::digits - countl_zero(x);
+}
+
+// Returns the 2-word product x * y, for words wider than `unsigned long long`.
+template <unsigned_integer_like Word>
+    requires (!std::unsigned_integral<Word>)
+[[nodiscard]] constexpr auto multiply_words(const Word& x, const Word& y) noexcept -> UnsignedDoubled<Word>
+{
+    // Schoolbook multiplication of half-words, as for `unsigned long long`. The products of half-words fit in one word.
+    constexpr unsigned half_digits { std::numeric_limits<Word>::digits / 2 };
+    const Word half_mask { (Word { 1U } << half_digits) - 1U };
+    const Word x0 { x & half_mask };
+    const Word x1 { x >> half_digits };
+    const Word y0 { y & half_mask };
+    const Word y1 { y >> half_digits };
+    const Word p00 { x0 * y0 };
+    const Word p01 { x0 * y1 };
+    const Word p10 { x1 * y0 };
+    const Word p11 { x1 * y1 };
+    const Word middle { (p00 >> half_digits) + (p01 & half_mask) + (p10 & half_mask) };
+    return UnsignedDoubled<Word>::from_words(p11 + (p01 >> half_digits) + (p10 >> half_digits) + (middle >> half_digits),
+        (middle << half_digits) | (p00 & half_mask));
+}
+
+// Returns (high * 2^digits + low) / d and the remainder, for words wider than `unsigned long long`.
+// Require: high < d, so that the quotient fits in one word.
+template <unsigned_integer_like Word>
+    requires (!std::unsigned_integral<Word>)
+[[nodiscard]] constexpr auto divide_words(const Word& high, const Word& low, Word d) noexcept -> std::pair<Word, Word>
+{
+    assert(high < d);
+    // Long division by half-word digits, as for `unsigned long long`. See: H. S. Warren, Hacker's Delight, 2nd ed., 9-4 (`divlu`).
+    constexpr unsigned digits { std::numeric_limits<Word>::digits };
+    constexpr unsigned half_digits { digits / 2 };
+    const Word base { Word { 1U } << half_digits };
+    const Word half_mask { base - 1U };
+    const auto s { static_cast<unsigned>(countl_zero(d)) };
+    d <<= s;
+    const Word d1 { d >> half_digits };
+    const Word d0 { d & half_mask };
+    const Word u32 { s == 0 ? high : (high << s) | (low >> (digits - s)) };
+    const Word u10 { low << s };
+    const Word u1 { u10 >> half_digits };
+    const Word u0 { u10 & half_mask };
+
+    // Each estimated digit is at most 2 too large.
+    const auto next_digit {
+        [&d1, &d0, &base](const Word& top, const Word& next) noexcept -> Word {
+            Word q { top / d1 };
+            Word r { top - (q * d1) };
+            while (q >= base || q * d0 > (base * r) + next) {
+                q -= 1U;
+                r += d1;
+                if (r >= base) {
+                    break;
+                }
+            }
+            return q;
+        }
+    };
+    const Word q1 { next_digit(u32, u1) };
+    // Wrapping is intended: the true value is below d.
+    const Word u21 { (u32 * base) + u1 - (q1 * d) };
+    const Word q0 { next_digit(u21, u0) };
+    return { (q1 * base) + q0, ((u21 * base) + u0 - (q0 * d)) >> s };
+}
+
+// Unsigned integer of two words of an unsigned type wider than `unsigned long long`, which wraps like the built-in
+// unsigned types. Two `UnsignedDoubledLongLong`s make the 256-bit double-width type of `UnsignedModder` for 128-bit
+// moduli. The operations are those of `UnsignedDoubledLongLong` on its two words, with the words' own arithmetic.
+template <typename Word>
+class UnsignedDoubled {
+    static constexpr int word_digits { std::numeric_limits<Word>::digits };
+
+    Word high_ {};
+    Word low_ {};
+
+public:
+    constexpr UnsignedDoubled() noexcept = default;
+
+    // Negative `x` wraps around, as in a conversion between built-in integers.
+    template <std::integral U>
+    constexpr UnsignedDoubled(U x) noexcept // NOLINT : implicit, as between built-in integers.
+        : low_ { x }
+    {
+        if constexpr (std::signed_integral<U>) {
+            high_ = x < 0 ? ~Word {} : Word {};
+        }
+    }
+
+    // From the word type, or another narrower unsigned type that is not a built-in integer, such as `__uint128_t`.
+    template <unsigned_integer_like U>
+        requires (!std::integral<U> && sizeof(U) <= sizeof(Word))
+    constexpr UnsignedDoubled(const U& x) noexcept // NOLINT : implicit, as between built-in integers.
+        : low_ { x }
+    {
+    }
+
+    // From a narrower signed type that is not a built-in integer, such as `__int128_t`, wrapping around when negative.
+    template <signed_integer_like U>
+        requires (!std::integral<U> && sizeof(U) <= sizeof(Word))
+    constexpr UnsignedDoubled(const U& x) noexcept // NOLINT : implicit, as between built-in integers.
+        : high_ { x < 0 ? ~Word {} : Word {} }
+        , low_ { static_cast<Word>(x) }
+    {
+    }
+
+    [[nodiscard]] static constexpr auto from_words(const Word& high, const Word& low) noexcept -> UnsignedDoubled
+    {
+        UnsignedDoubled result {};
+        result.high_ = high;
+        result.low_ = low;
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto high() const noexcept -> Word { return high_; }
+    [[nodiscard]] constexpr auto low() const noexcept -> Word { return low_; }
+
+    template <typename U>
+        requires (std::integral<U> || unsigned_integer_like<U>) && (sizeof(U) <= sizeof(Word))
+    [[nodiscard]] explicit constexpr operator U() const noexcept
+    {
+        if constexpr (std::same_as<U, bool>) {
+            return high_ != 0 || low_ != 0;
+        } else {
+            return static_cast<U>(low_);
+        }
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> bool = default;
+    [[nodiscard]] friend constexpr auto operator<=>(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> std::strong_ordering = default;
+
+    [[nodiscard]] friend constexpr auto operator~(const UnsignedDoubled& x) noexcept -> UnsignedDoubled
+    {
+        return from_words(~x.high_, ~x.low_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const UnsignedDoubled& x) noexcept -> UnsignedDoubled
+    {
+        return UnsignedDoubled {} - x;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        const Word low { lhs.low_ + rhs.low_ };
+        return from_words(lhs.high_ + rhs.high_ + (low < lhs.low_ ? Word { 1U } : Word {}), low);
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return from_words(lhs.high_ - rhs.high_ - (lhs.low_ < rhs.low_ ? Word { 1U } : Word {}), lhs.low_ - rhs.low_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator*(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        const UnsignedDoubled low_product { multiply_words(lhs.low_, rhs.low_) };
+        return from_words(low_product.high_ + (lhs.low_ * rhs.high_) + (lhs.high_ * rhs.low_), low_product.low_);
+    }
+
+    // Returns the quotient and the remainder, rounded towards 0, as `UnsignedDoubledLongLong` does.
+    // Require: rhs != 0.
+    [[nodiscard]] friend constexpr auto divide(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> std::pair<UnsignedDoubled, UnsignedDoubled>
+    {
+        assert(rhs != 0);
+        if (rhs.high_ == 0) {
+            const Word& d { rhs.low_ };
+            if (lhs.high_ < d) {
+                const auto [quotient, remainder] { divide_words(lhs.high_, lhs.low_, d) };
+                return { quotient, remainder };
+            }
+            const auto [quotient, remainder] { divide_words(lhs.high_ % d, lhs.low_, d) };
+            return { from_words(lhs.high_ / d, quotient), remainder };
+        }
+        // See: H. S. Warren, Hacker's Delight, 2nd ed., 9-5.
+        const auto n { static_cast<unsigned>(countl_zero(rhs.high_)) };
+        const Word v1 { (rhs << n).high_ };
+        const UnsignedDoubled u1 { lhs >> 1U };
+        const Word q1 { divide_words(u1.high_, u1.low_, v1).first };
+        Word quotient { static_cast<Word>((UnsignedDoubled { q1 } << n) >> static_cast<unsigned>(word_digits - 1)) };
+        if (quotient != 0) {
+            quotient -= 1U;
+        }
+        UnsignedDoubled remainder { lhs - (rhs * quotient) };
+        if (remainder >= rhs) {
+            quotient += 1U;
+            remainder -= rhs;
+        }
+        return { quotient, remainder };
+    }
+
+    [[nodiscard]] friend constexpr auto operator/(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return divide(lhs, rhs).first;
+    }
+
+    [[nodiscard]] friend constexpr auto operator%(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return divide(lhs, rhs).second;
+    }
+
+    [[nodiscard]] friend constexpr auto operator&(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return from_words(lhs.high_ & rhs.high_, lhs.low_ & rhs.low_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator|(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return from_words(lhs.high_ | rhs.high_, lhs.low_ | rhs.low_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator^(const UnsignedDoubled& lhs, const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled
+    {
+        return from_words(lhs.high_ ^ rhs.high_, lhs.low_ ^ rhs.low_);
+    }
+
+    // Require: n < 2 * word_digits, as for the built-in types.
+    [[nodiscard]] friend constexpr auto operator<<(const UnsignedDoubled& x, unsigned n) noexcept -> UnsignedDoubled
+    {
+        assert(n < 2 * word_digits);
+        if (n >= word_digits) {
+            return from_words(x.low_ << (n - word_digits), 0);
+        }
+        return from_words((x.high_ << n) | ((x.low_ >> 1U) >> (word_digits - 1 - n)), x.low_ << n);
+    }
+
+    // Require: n < 2 * word_digits, as for the built-in types.
+    [[nodiscard]] friend constexpr auto operator>>(const UnsignedDoubled& x, unsigned n) noexcept -> UnsignedDoubled
+    {
+        assert(n < 2 * word_digits);
+        if (n >= word_digits) {
+            return from_words(0, x.high_ >> (n - word_digits));
+        }
+        return from_words(x.high_ >> n, (x.low_ >> n) | ((x.high_ << 1U) << (word_digits - 1 - n)));
+    }
+
+    constexpr auto operator+=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this + rhs; }
+    constexpr auto operator-=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this - rhs; }
+    constexpr auto operator*=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this * rhs; }
+    constexpr auto operator/=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this / rhs; }
+    constexpr auto operator%=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this % rhs; }
+    constexpr auto operator&=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this & rhs; }
+    constexpr auto operator|=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this | rhs; }
+    constexpr auto operator^=(const UnsignedDoubled& rhs) noexcept -> UnsignedDoubled& { return *this = *this ^ rhs; }
+    constexpr auto operator<<=(unsigned n) noexcept -> UnsignedDoubled& { return *this = *this << n; }
+    constexpr auto operator>>=(unsigned n) noexcept -> UnsignedDoubled& { return *this = *this >> n; }
+};
+
+template <integer_like T>
+struct least_doubled_uint {
+private:
+    template <unsigned_integer_like Head, unsigned_integer_like... Tail>
+    struct finder {
+        using type = std::conditional_t<
+            sizeof(Head) >= 2 * sizeof(T),
+            Head,
+            typename finder<Tail...>::type>;
+    };
+
+    template <unsigned_integer_like Last>
+    struct finder<Last> {
+        using type = Last;
+    };
+
+    template <unsigned_integer_like... Ts>
+    using finder_t = finder<Ts...>::type;
+
+public:
+    using type = finder_t<
+        unsigned int,
+        unsigned long,
+        unsigned long long,
+#if defined(__SIZEOF_INT128__)
+        __uint128_t,
+#else
+        UnsignedDoubledLongLong,
+#endif
+        UnsignedDoubled<UnsignedDoubledLongLong>>;
+    static_assert(unsigned_integer_like<type>);
+    static_assert(sizeof(type) >= 2 * sizeof(T));
+};
+
+template <integer_like T>
+using least_doubled_uint_t = typename least_doubled_uint<T>::type;
+
+// The signed type of the same width as `U`.
+template <unsigned_integer_like U>
+struct signed_counterpart {
+    using type = std::make_signed_t<U>;
+};
+
+template <>
+struct signed_counterpart<UnsignedDoubledLongLong> {
+    using type = DoubledLongLong;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <>
+struct signed_counterpart<__uint128_t> {
+    using type = __int128_t;
+};
+#endif
+
+template <unsigned_integer_like U>
+using signed_counterpart_t = typename signed_counterpart<U>::type;
+
+template <std::integral T>
+struct least_doubled_int {
+    using type = signed_counterpart_t<least_doubled_uint_t<T>>;
+    static_assert(signed_integer_like<type>);
+    static_assert(sizeof(type) >= 2 * sizeof(T));
+};
+
+template <std::integral T>
+using least_doubled_int_t = typename least_doubled_int<T>::type;
+
+template <typename Op, typename T>
+concept BinaryClosure = requires(Op op, T x, T y) {
+    { op(x, y) } -> std::convertible_to<T>;
+};
+
+#if defined(LCG_PREDICT_INSTRUMENT)
+constexpr inline bool instrumented { true };
+#else
+constexpr inline bool instrumented { false };
+#endif
+
+// Step distances are counted by bit width: bucket 0 holds 0, and bucket k holds [2^(k - 1), 2^k).
+constexpr inline std::size_t distance_buckets { 129 };
+
+// What the hot paths did, as counted with `LCG_PREDICT_INSTRUMENT` defined. Every field only grows, so the work
+// between two snapshots is their difference.
+struct InstrumentCounters {
+    // Calls of `UnsignedModder::times_mod`, and of `times_plus_mod` and `times_plus_plus_mod`, by the
+    // `ReductionKind` of the modulus: mask, mersenne, barrett.
+    std::array<std::uint64_t, 3> times_mod {};
+    std::array<std::uint64_t, 3> times_plus_mod {};
+    // Calls of `LCGAffineTransform::compose_assign`, including those made by `powered`.
+    std::uint64_t compose_assign {};
+    // Calls of `double_and_add`, and its iterations: one per bit of each exponent.
+    std::uint64_t double_and_add_calls {};
+    std::uint64_t double_and_add_iterations {};
+    // `LCGAffineTransform::powered(n)`, by the bit width of n, including the calls behind engine jumps.
+    std::array<std::uint64_t, distance_buckets> powered_distances {};
+    // Values produced by `LCGEngine::operator()` and `generate`, one at a time or in bulk.
+    std::uint64_t engine_steps {};
+    // Jumps of `LCGEngine` (`value_after_n_steps`, `value_before_n_steps`, `discard` and each index of `values_at`),
+    // by the bit width of their distance, and how many of them went backwards or through an `LCGJumpTable`.
+    std::array<std::uint64_t, distance_buckets> jump_distances {};
+    std::uint64_t backward_jumps {};
+    std::uint64_t table_jumps {};
+
+    // Calls `f(x.counter, y.counter)` for every counter, in declaration order.
+    template <typename X, typename Y, typename F>
+    static constexpr auto zip(X& x, Y& y, F f) -> void
+    {
+        const auto zip_array {
+            [&f](auto& lhs, auto& rhs) -> void {
+                for (std::size_t i { 0 }; i != lhs.size(); ++i) {
+                    f(lhs[i], rhs[i]);
+                }
+            }
+        };
+        zip_array(x.times_mod, y.times_mod);
+        zip_array(x.times_plus_mod, y.times_plus_mod);
+        f(x.compose_assign, y.compose_assign);
+        f(x.double_and_add_calls, y.double_and_add_calls);
+        f(x.double_and_add_iterations, y.double_and_add_iterations);
+        zip_array(x.powered_distances, y.powered_distances);
+        f(x.engine_steps, y.engine_steps);
+        zip_array(x.jump_distances, y.jump_distances);
+        f(x.backward_jumps, y.backward_jumps);
+        f(x.table_jumps, y.table_jumps);
+    }
+
+    constexpr auto operator+=(const InstrumentCounters& rhs) noexcept -> InstrumentCounters&
+    {
+        zip(*this, rhs, [](std::uint64_t& total, std::uint64_t value) noexcept -> void { total += value; });
+        return *this;
+    }
+
+    // Require: `rhs` be an earlier snapshot of the same counters.
+    constexpr auto operator-=(const InstrumentCounters& rhs) noexcept -> InstrumentCounters&
+    {
+        zip(*this, rhs, [](std::uint64_t& total, std::uint64_t value) noexcept -> void { total -= value; });
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(InstrumentCounters lhs, const InstrumentCounters& rhs) noexcept -> InstrumentCounters
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(InstrumentCounters lhs, const InstrumentCounters& rhs) noexcept -> InstrumentCounters
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const InstrumentCounters& lhs, const InstrumentCounters& rhs) noexcept -> bool = default;
+
+    // One `name: value` line per counter, and one `bits: count` pair per nonzero bucket of each histogram.
+    friend auto operator<<(std::ostream& os, const InstrumentCounters& counters) -> std::ostream&
+    {
+        const auto histogram {
+            [&os](const char* name, const std::array<std::uint64_t, distance_buckets>& buckets) -> void {
+                os << name << " (bits: count):";
+                for (std::size_t bits { 0 }; bits != buckets.size(); ++bits) {
+                    if (buckets[bits] != 0) {
+                        os << ' ' << bits << ": " << buckets[bits];
+                    }
+                }
+                os << '\n';
+            }
+        };
+        const auto by_kind {
+            [&os](const char* name, const std::array<std::uint64_t, 3>& kinds) -> void {
+                os << name << " (mask, mersenne, barrett): " << kinds[0] << ", " << kinds[1] << ", " << kinds[2] << '\n';
+            }
+        };
+        by_kind("times_mod", counters.times_mod);
+        by_kind("times_plus_mod", counters.times_plus_mod);
+        os << "compose_assign: " << counters.compose_assign << '\n'
+           << "double_and_add: " << counters.double_and_add_calls << " calls, " << counters.double_and_add_iterations << " iterations" << '\n';
+        histogram("powered distances", counters.powered_distances);
+        os << "engine steps: " << counters.engine_steps << '\n';
+        histogram("jump distances", counters.jump_distances);
+        os << "backward jumps: " << counters.backward_jumps << '\n'
+           << "table jumps: " << counters.table_jumps << '\n';
+        return os;
+    }
+};
+
+#if defined(LCG_PREDICT_INSTRUMENT)
+struct ThreadCounters;
+
+// The counters of the running threads, and the sum of those of the threads that have exited.
+struct InstrumentRegistry {
+    std::mutex mutex;
+    std::vector<ThreadCounters*> running;
+    InstrumentCounters exited;
+};
+
+[[nodiscard]] inline auto instrument_registry() -> InstrumentRegistry&
+{
+    static InstrumentRegistry registry;
+    return registry;
+}
+
+// Only the owning thread writes its counters, so an increment is a relaxed load and store instead of a locked
+// read-modify-write, and other threads may still read them whole for a snapshot.
+// The counters are constant-initialized and trivially destructible, so reaching them needs no guard for a
+// dynamic initialization; the thread is registered on its first count instead.
+struct ThreadCounters {
+    alignas(std::atomic_ref<std::uint64_t>::required_alignment) InstrumentCounters counters;
+    bool registered;
+};
+
+constinit inline thread_local ThreadCounters thread_counters_storage {};
+
+// Adds the counters of the calling thread to the registry, and moves them to the exited sum when it exits.
+class ThreadRegistration {
+    ThreadCounters* counters_;
+
+public:
+    explicit ThreadRegistration(ThreadCounters& counters)
+        : counters_ { &counters }
+    {
+        InstrumentRegistry& registry { instrument_registry() };
+        const std::scoped_lock lock { registry.mutex };
+        registry.running.push_back(counters_);
+    }
+
+    ThreadRegistration(const ThreadRegistration&) = delete;
+    auto operator=(const ThreadRegistration&) -> ThreadRegistration& = delete;
+
+    ~ThreadRegistration()
+    {
+        InstrumentRegistry& registry { instrument_registry() };
+        const std::scoped_lock lock { registry.mutex };
+        registry.exited += counters_->counters;
+        std::erase(registry.running, counters_);
+    }
+};
+
+[[nodiscard]] inline auto this_thread_counters() noexcept -> ThreadCounters&
+{
+    ThreadCounters& counters { thread_counters_storage };
+    if (!counters.registered) [[unlikely]] {
+        thread_local const ThreadRegistration registration { counters };
+        counters.registered = true;
+    }
+    return counters;
+}
+
+inline auto bump(std::uint64_t& counter, std::uint64_t n) noexcept -> void
+{
+    const std::atomic_ref<std::uint64_t> ref { counter };
+    ref.store(ref.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+#endif
+
+// Adds `n` to `counter` of the calling thread.
+// Does nothing without `LCG_PREDICT_INSTRUMENT`, or during constant evaluation.
+constexpr auto instrument_count(std::uint64_t InstrumentCounters::*counter, std::uint64_t n = 1) noexcept -> void
+{
+#if defined(LCG_PREDICT_INSTRUMENT)
+    if (!std::is_constant_evaluated()) {
+        bump(this_thread_counters().counters.*counter, n);
+    }
+#else
+    (void)counter;
+    (void)n;
+#endif
+}
+
+// Counts `distance` in `histogram` of the calling thread, like `instrument_count`.
+template <unsigned_integer_like N>
+constexpr auto instrument_distance(std::array<std::uint64_t, distance_buckets> InstrumentCounters::*histogram, const N& distance) noexcept -> void
+{
+#if defined(LCG_PREDICT_INSTRUMENT)
+    if (!std::is_constant_evaluated()) {
+        bump((this_thread_counters().counters.*histogram)[static_cast<std::size_t>(detail::bit_width(distance))], 1);
+    }
+#else
+    (void)histogram;
+    (void)distance;
+#endif
+}
+
+// Generalized fast pow algorithm.
+// Require: `op` be associative.
+// Require: `unit` be the identity for `op`.
+// Returns: (elem op elem op ... op elem). There are `n` `elem`'s. If `n` == 0, returns `unit`.
+template <typename T, unsigned_integer_like N, typename Op>
+[[nodiscard]] constexpr auto double_and_add(const T& elem, N n, const Op& op, const T& unit) -> T
+    requires BinaryClosure<std::remove_cvref_t<Op>, std::remove_cvref_t<T>>
+{
+    if constexpr (instrumented) {
+        instrument_count(&InstrumentCounters::double_and_add_calls);
+        instrument_count(&InstrumentCounters::double_and_add_iterations, static_cast<std::uint64_t>(detail::bit_width(n)));
+    }
+    std::remove_cvref_t<T> result { unit };
+    std::remove_cvref_t<T> var_elem { elem };
+    for (/* void */; n != 0; n >>= 1U) {
+        if ((n & 1U) != 0) {
+            result = op(std::move(result), var_elem);
+        }
+        var_elem = op(var_elem, var_elem);
+    }
+    return result;
+}
+
+// Returns |n| without overflow for the most negative `n`.
+template <std::signed_integral T>
+[[nodiscard]] constexpr auto magnitude(T n) noexcept -> unsigned long long
+{
+    return n >= 0 ? static_cast<unsigned long long>(n) : static_cast<unsigned long long>(-(n + 1)) + 1;
+}
+
+// Returns: { gen(), gen(), ..., gen() }. There are `N` calls, evaluated in order.
+template <std::size_t N, typename Gen>
+[[nodiscard]] constexpr auto generate_array(Gen gen) -> std::array<std::invoke_result_t<Gen&>, N>
+{
+    return [&gen]<std::size_t... I>(std::index_sequence<I...>) -> std::array<std::invoke_result_t<Gen&>, N> {
+        // Elements of a braced-init-list are evaluated from left to right.
+        return { ((void)I, gen())... };
+    }(std::make_index_sequence<N> {});
+}
+
+// How `UnsignedModder` reduces a double-width value.
+enum class ReductionKind : unsigned char {
+    // m == 0 or m == 2^k: keep the low bits.
+    mask,
+    // m == 2^k - 1: fold the high bits onto the low bits, as 2^k == 1 (mod m).
+    mersenne,
+    // Other m: Barrett-style division by an invariant integer, with a precomputed reciprocal of m.
+    // See: N. Moller, T. Granlund. Improved division by invariant integers. IEEE Trans. Comput., 2011.
+    barrett,
+};
+
+// Counts a call modulo a modulus of `kind` in `by_kind` of the calling thread, like `instrument_count`.
+constexpr auto instrument_call(std::array<std::uint64_t, 3> InstrumentCounters::*by_kind, ReductionKind kind) noexcept -> void
+{
+#if defined(LCG_PREDICT_INSTRUMENT)
+    if (!std::is_constant_evaluated()) {
+        bump((this_thread_counters().counters.*by_kind)[static_cast<std::size_t>(kind)], 1);
+    }
+#else
+    (void)by_kind;
+    (void)kind;
+#endif
+}
+
+// When m == 0, the modulus mathematically equals (numeric_limits<T>::max() + 1).
+// The reduction strategy is chosen once, when the modulus is set.
+// `UnsignedBigger` holds double-width products; it is only chosen otherwise to compare the alternatives, e.g.
+// `UnsignedDoubledLongLong` against the default `__uint128_t` for 64-bit T.
+// With T wider than `unsigned long long`, the double-width type is `UnsignedDoubled`, and products modulo 2^k are
+// computed in T instead, as that is exact and much cheaper.
+template <unsigned_integer_like T, unsigned_integer_like UnsignedBigger = least_doubled_uint_t<T>>
+    requires (sizeof(UnsignedBigger) >= 2 * sizeof(T))
+struct UnsignedModder {
+private:
+    static constexpr bool wide { sizeof(T) > sizeof(unsigned long long) };
+    static constexpr int digits { std::numeric_limits<T>::digits };
+
+    T m_;
+    ReductionKind kind_;
+    // With `mersenne`: k, where m == 2^k - 1.
+    // With `barrett`: the number of leading zero bits of m.
+    unsigned char shift_;
+    // With `barrett`: floor((2^(2 * digits) - 1) / d) - 2^digits, where d == m << shift_ has its top bit set.
+    T reciprocal_;
+
+    [[nodiscard]] static constexpr auto choose_kind(T m) noexcept -> ReductionKind
+    {
+        if ((m & (m - 1)) == 0) {
+            return ReductionKind::mask;
+        }
+        if ((m & (m + 1)) == 0) {
+            return ReductionKind::mersenne;
+        }
+        return ReductionKind::barrett;
+    }
+
+    [[nodiscard]] static constexpr auto choose_shift(T m, ReductionKind kind) noexcept -> unsigned char
+    {
+        switch (kind) {
+        case ReductionKind::mask:
+            return 0;
+        case ReductionKind::mersenne:
+            return static_cast<unsigned char>(detail::bit_width(m));
+        case ReductionKind::barrett:
+            return static_cast<unsigned char>(detail::countl_zero(m));
+        }
+        return 0;
+    }
+
+    [[nodiscard]] static constexpr auto choose_reciprocal(T m, ReductionKind kind, unsigned char shift) noexcept -> T
+    {
+        if (kind != ReductionKind::barrett) {
+            return 0;
+        }
+        const UnsignedBigger double_word_max { (static_cast<UnsignedBigger>(std::numeric_limits<T>::max()) << digits) | std::numeric_limits<T>::max() };
+        // The quotient lies in [2^digits, 2^(digits + 1)), so dropping the top bit subtracts 2^digits.
+        return static_cast<T>(double_word_max / static_cast<T>(m << shift));
+    }
+
+    [[nodiscard]] constexpr auto fold(T x) const noexcept -> T
+    {
+        return static_cast<T>((x & m_) + (x >> shift_));
+    }
+
+    // Require: x < 2^digits.
+    [[nodiscard]] constexpr auto reduce_mersenne(T x) const noexcept -> T
+    {
+        if (shift_ == digits) {
+            // m == 2^digits - 1, so x <= m already.
+            return x == m_ ? 0 : x;
+        }
+        // Below 2^(2k), two folds bring x into [0, m + 1]. Larger values only occur for k < digits / 2.
+        if (2 * shift_ < digits) {
+            while ((x >> (2 * shift_)) != 0) {
+                x = this->fold(x);
+            }
+        }
+        x = this->fold(this->fold(x));
+        return static_cast<T>(x >= m_ ? x - m_ : x);
+    }
+
+    // Require: x < m * 2^digits.
+    [[nodiscard]] constexpr auto reduce_barrett(UnsignedBigger x) const noexcept -> T
+    {
+        const auto d { static_cast<T>(m_ << shift_) };
+        const UnsignedBigger normalized { x << shift_ };
+        const auto u1 { static_cast<T>(normalized >> digits) };
+        const auto u0 { static_cast<T>(normalized) };
+        // Estimated quotient in the high word, with the low word for the correction steps. Wrapping is intended.
+        const UnsignedBigger estimate { (static_cast<UnsignedBigger>(reciprocal_) * u1) + (static_cast<UnsignedBigger>(u1 + 1U) << digits) + u0 };
+        const auto q1 { static_cast<T>(estimate >> digits) };
+        const auto q0 { static_cast<T>(estimate) };
+        auto remainder { static_cast<T>(u0 - static_cast<T>(static_cast<UnsignedBigger>(q1) * d)) };
+        if (remainder > q0) {
+            remainder = static_cast<T>(remainder + d);
+        }
+        if (remainder >= d) {
+            remainder = static_cast<T>(remainder - d);
+        }
+        return static_cast<T>(remainder >> shift_);
+    }
+
+    [[nodiscard]] constexpr auto reduce(UnsignedBigger x) const noexcept -> T
+    {
+        switch (kind_) {
+        case ReductionKind::mask:
+            return static_cast<T>(static_cast<T>(x) & static_cast<T>(m_ - 1U));
+        case ReductionKind::mersenne:
+            // 2^digits == 2^(digits - k) (mod m), so the high word folds onto the low word first.
+            while ((x >> digits) != 0) {
+                x = (x & m_) + (x >> shift_);
+            }
+            return this->reduce_mersenne(static_cast<T>(x));
+        case ReductionKind::barrett:
+            break;
+        }
+        // Products of a value of `T` and a residue are below m * 2^digits. Other inputs first reduce their high
+        // word, with a single-width `%`, so that no double-width division is needed.
+        if (const auto high { static_cast<T>(x >> digits) }; high >= m_) {
+            x = (static_cast<UnsignedBigger>(high % m_) << digits) | static_cast<T>(x);
+        }
+        return this->reduce_barrett(x);
+    }
+
+    [[nodiscard]] constexpr auto internal_sum(T x) const noexcept -> UnsignedBigger
+    {
+        return static_cast<UnsignedBigger>(x);
+    }
+
+    template <typename... Tail>
+    [[nodiscard]] constexpr auto internal_sum(T x, Tail... tail) const noexcept -> UnsignedBigger
+    {
+        return static_cast<UnsignedBigger>(x) + internal_sum(tail...);
+    }
+
+    [[nodiscard]] constexpr auto internal_prod_mod(T x) const noexcept -> UnsignedBigger
+    {
+        return (*this)(static_cast<UnsignedBigger>(x));
+    }
+
+    // The product of two values of `T` always fits in `UnsignedBigger`, so one reduction suffices.
+    [[nodiscard]] constexpr auto internal_prod_mod(T x, T y) const noexcept -> UnsignedBigger
+    {
+        if constexpr (wide) {
+            if (kind_ == ReductionKind::mask) {
+                return static_cast<T>((x * y) & static_cast<T>(m_ - 1U));
+            }
+        }
+        return (*this)(static_cast<UnsignedBigger>(x) * y);
+    }
+
+    template <typename... Tail>
+    [[nodiscard]] constexpr auto internal_prod_mod(T x, Tail... tail) const noexcept -> UnsignedBigger
+    {
+        return (*this)(static_cast<UnsignedBigger>(x) * internal_prod_mod(tail...));
+    }
+
+public:
+    explicit constexpr UnsignedModder(T m) noexcept
+        : m_ { m }
+        , kind_ { choose_kind(m) }
+        , shift_ { choose_shift(m, kind_) }
+        , reciprocal_ { choose_reciprocal(m, kind_, shift_) }
+    {
+    }
+
+    [[nodiscard]] constexpr auto m() const noexcept -> T { return m_; }
+    [[nodiscard]] constexpr auto kind() const noexcept -> ReductionKind { return kind_; }
+    constexpr auto set_m(T m) noexcept -> void { *this = UnsignedModder { m }; }
+
+    template <typename Bigger>
+    [[nodiscard]] constexpr auto real_m() const noexcept -> Bigger
+        requires integer_like<Bigger> && (sizeof(Bigger) > sizeof(T))
+    {
+        return m_ != 0 ? m_ : static_cast<Bigger>(std::numeric_limits<T>::max()) + 1;
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr auto operator()(U x) const noexcept -> T
+        requires unsigned_integer_like<std::remove_cvref_t<U>> && (sizeof(std::remove_cvref_t<U>) <= sizeof(UnsignedBigger))
+    {
+        // The mask is tested here as well as in `reduce`, so that it is inlined into every caller even where `reduce` is not.
+        if (kind_ == ReductionKind::mask) {
+            return static_cast<T>(static_cast<T>(x) & static_cast<T>(m_ - 1U));
+        }
+        return this->reduce(static_cast<UnsignedBigger>(x));
+    }
+
+    template <typename U>
+    [[nodiscard]] constexpr auto operator()(U x) const noexcept -> T
+        requires signed_integer_like<std::remove_cvref_t<U>> && (sizeof(std::remove_cvref_t<U>) <= sizeof(UnsignedBigger))
+    {
+        // Reduces |x|, which fits in `UnsignedBigger` even for the most negative x, and negates the result.
+        const bool negative { x < 0 };
+        const auto bits { static_cast<UnsignedBigger>(x) };
+        const T result { this->reduce(negative ? -bits : bits) };
+        return negative && result != 0 ? static_cast<T>(this->real_m<UnsignedBigger>() - result) : result;
+    }
+
+    [[nodiscard]] constexpr auto mod(T x) const noexcept -> T
+    {
+        return (*this)(x);
+    }
+
+    template <typename... Args>
+    [[nodiscard]] constexpr auto plus_mod(Args... args) const noexcept -> T
+    {
+        return (*this)(internal_sum(args...));
+    }
+
+    // Require: x, y in [0, m).
+    [[nodiscard]] constexpr auto minus_mod(T x, T y) const noexcept -> T
+    {
+        // Wrapping below 0 in `UnsignedBigger` would add 2^digits, which is not a multiple of m in general.
+        return x >= y ? (*this)(static_cast<T>(x - y)) : (*this)((static_cast<UnsignedBigger>(x) + this->real_m<UnsignedBigger>()) - y);
+    }
+
+    template <typename... Args>
+    [[nodiscard]] constexpr auto times_mod(Args... args) const noexcept -> T
+    {
+        instrument_call(&InstrumentCounters::times_mod, kind_);
+        return static_cast<T>(internal_prod_mod(args...));
+    }
+
+    [[nodiscard]] constexpr auto times_plus_mod(T x, T y, T z) const noexcept -> T
+    {
+        instrument_call(&InstrumentCounters::times_plus_mod, kind_);
+        if constexpr (wide) {
+            if (kind_ == ReductionKind::mask) {
+                return static_cast<T>(((x * y) + z) & static_cast<T>(m_ - 1U));
+            }
+        }
+        return (*this)((static_cast<UnsignedBigger>(x) * y) + z);
+    }
+
+    [[nodiscard]] constexpr auto times_plus_plus_mod(T x, T y, T z, T w) const noexcept -> T
+    {
+        instrument_call(&InstrumentCounters::times_plus_mod, kind_);
+        if constexpr (wide) {
+            if (kind_ == ReductionKind::mask) {
+                return static_cast<T>(((x * y) + z + w) & static_cast<T>(m_ - 1U));
+            }
+        }
+        return (*this)((static_cast<UnsignedBigger>(x) * y) + z + w);
+    }
+
+    [[nodiscard]] constexpr auto pow_mod(T base, unsigned long long expo) const noexcept -> T
+    {
+        const auto mul_mod {
+            [*this](T x, T y) noexcept -> T {
+                return this->times_mod(x, y);
+            }
+        };
+        return double_and_add(base, expo, mul_mod, (*this)(1U));
+    }
+
+    [[nodiscard]] constexpr friend auto operator==(UnsignedModder lhs, UnsignedModder rhs) noexcept -> bool = default;
+};
+
+// Returns x such that ax = 1 (mod m), or `std::nullopt` if gcd(a, m) != 1.
+template <unsigned_integer_like T>
+[[nodiscard]] constexpr auto inv_mod(T a, const UnsignedModder<T>& modder) noexcept -> std::optional<T>
+{
+    using UnsignedBigger = least_doubled_uint_t<T>;
+
+    a = modder(a);
+    if (a == 0) {
+        return modder.m() == 1 ? std::optional<T> { 0 } : std::nullopt;
+    }
+    if (a == 1) {
+        return modder(1U);
+    }
+
+    // Extended Euclid on (m, a), keeping only the coefficients of a, modulo m, so that every value is unsigned
+    // and fits in `T`: r0 = s0 * a and r1 = s1 * a (mod m).
+    // The first step divides the real m, which is 1 bigger than std::numeric_limits<T>::max() when m == 0.
+    const auto real_m { modder.template real_m<UnsignedBigger>() };
+    T r0 { a };
+    T r1 { static_cast<T>(real_m % a) };
+    T s0 { modder(1U) };
+    // Case where a == 1 or 0 is handled above. So T is able represent the quotient.
+    T s1 { modder.minus_mod(0U, static_cast<T>(real_m / a)) };
+    while (r1 != 0) {
+        const auto q { static_cast<T>(r0 / r1) };
+        const T r2 { static_cast<T>(r0 - (q * r1)) };
+        const T s2 { modder.minus_mod(s0, modder.times_mod(q, s1)) };
+        r0 = r1;
+        r1 = r2;
+        s0 = s1;
+        s1 = s2;
+    }
+
+    if (r0 != 1) {
+        return std::nullopt;
+    }
+    assert(modder.times_mod(a, s0) == modder(1U));
+    return s0;
+}
+
+// Deterministic Miller-Rabin test. The bases are the primes up to 37, which suffice below 3.3 * 10^24.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto is_prime(T n) noexcept -> bool
+{
+    constexpr std::array<unsigned, 12> bases { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+    if (n < 2) {
+        return false;
+    }
+    for (const unsigned base : bases) {
+        if (n % base == 0) {
+            return n == base;
+        }
+    }
+
+    const UnsignedModder<T> modder { n };
+    const T n_minus_1 { static_cast<T>(n - 1U) };
+    const int s { std::countr_zero(n_minus_1) };
+    const T d { static_cast<T>(n_minus_1 >> s) };
+    for (const unsigned base : bases) {
+        T x { modder.pow_mod(static_cast<T>(base), d) };
+        if (x == 1 || x == n_minus_1) {
+            continue;
+        }
+        bool witness { true };
+        for (int r { 1 }; r < s && witness; ++r) {
+            x = modder.times_mod(x, x);
+            witness = x != n_minus_1;
+        }
+        if (witness) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns a nontrivial factor of `n`, with Pollard's rho algorithm.
+// Require: `n` be odd and composite.
+// Time complexity: expected O(n^(1/4)) multiplications.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto pollard_rho(T n) noexcept -> T
+{
+    assert(n % 2 == 1 && !is_prime(n));
+    const UnsignedModder<T> modder { n };
+    for (T increment { 1 };; ++increment) {
+        const auto next {
+            [&modder, increment](T x) noexcept -> T {
+                return modder.times_plus_mod(x, x, increment);
+            }
+        };
+        T slow { 2 };
+        T fast { 2 };
+        T d { 1 };
+        while (d == 1) {
+            slow = next(slow);
+            fast = next(next(fast));
+            d = std::gcd(static_cast<T>(slow > fast ? slow - fast : fast - slow), n);
+        }
+        if (d != n) {
+            return d;
+        }
+    }
+}
+
+template <std::unsigned_integral T>
+struct PrimePower {
+    T prime;
+    unsigned exponent;
+
+    [[nodiscard]] friend constexpr auto operator==(const PrimePower& lhs, const PrimePower& rhs) noexcept -> bool = default;
+};
+
+// Returns the prime factorization of `n`, in increasing order of primes.
+// Require: n > 0.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto factorize(T n) -> std::vector<PrimePower<T>>
+{
+    assert(n > 0);
+    std::vector<T> primes {};
+    // Small factors by trial division, so that Pollard's rho only sees odd numbers with large factors.
+    for (T p { 2 }; p < 1024 && p <= n / p; p += (p == 2 ? 1 : 2)) {
+        for (/* void */; n % p == 0; n /= p) {
+            primes.push_back(p);
+        }
+    }
+    std::vector<T> pending {};
+    if (n != 1) {
+        pending.push_back(n);
+    }
+    while (!pending.empty()) {
+        const T x { pending.back() };
+        pending.pop_back();
+        if (is_prime(x)) {
+            primes.push_back(x);
+        } else {
+            const T factor { pollard_rho(x) };
+            pending.push_back(factor);
+            pending.push_back(x / factor);
+        }
+    }
+
+    std::ranges::sort(primes);
+    std::vector<PrimePower<T>> result {};
+    for (const T p : primes) {
+        if (!result.empty() && result.back().prime == p) {
+            ++result.back().exponent;
+        } else {
+            result.push_back({ p, 1 });
+        }
+    }
+    return result;
+}
+
+// Returns ceil(sqrt(n)).
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto ceil_sqrt(T n) noexcept -> T
+{
+    using UnsignedBigger = least_doubled_uint_t<T>;
+    T low { 0 };
+    T high { static_cast<T>(T { 1 } << ((std::numeric_limits<T>::digits + 1) / 2)) };
+    // Invariant: low * low < n <= high * high, unless n == 0.
+    if (n == 0) {
+        return 0;
+    }
+    while (high - low > 1) {
+        const T mid { static_cast<T>(low + ((high - low) / 2)) };
+        if (static_cast<UnsignedBigger>(mid) * mid < n) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return high;
+}
+
+// Returns d in [0, order) such that base^d = target, with baby-step giant-step.
+// Require: `base` have multiplicative order `order` modulo `modder.m()`.
+// Time complexity: O(sqrt(order) log(order)).
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto baby_step_giant_step(T base, T target, T order, const UnsignedModder<T>& modder) -> std::optional<T>
+{
+    struct BabyStep {
+        T value;
+        T exponent;
+    };
+
+    const T step { ceil_sqrt(order) };
+    std::vector<BabyStep> baby_steps {};
+    baby_steps.reserve(step);
+    T power { modder(1U) };
+    for (T j { 0 }; j != step; ++j) {
+        baby_steps.push_back({ power, j });
+        power = modder.times_mod(power, base);
+    }
+    std::ranges::sort(baby_steps, {}, &BabyStep::value);
+
+    // base^(-step) = base^(order - step mod order).
+    const T giant { modder.pow_mod(base, (order - (step % order)) % order) };
+    T current { target };
+    for (T i { 0 }; i != step; ++i) {
+        const auto found { std::ranges::lower_bound(baby_steps, current, {}, &BabyStep::value) };
+        if (found != baby_steps.end() && found->value == current) {
+            const T d { static_cast<T>((static_cast<least_doubled_uint_t<T>>(i) * step) + found->exponent) };
+            if (d < order) {
+                return d;
+            }
+        }
+        current = modder.times_mod(current, giant);
+    }
+    return std::nullopt;
+}
+
+// Returns the least n >= 0 such that base^n = target (mod p), or `std::nullopt` if there is none.
+// Uses Pohlig-Hellman over the multiplicative order of `base`, and baby-step giant-step for each prime factor.
+// Require: `modder.m()` be a prime p, and `base` and `target` be nonzero and less than p.
+// Time complexity: O(factorization of p - 1) + O(sum of e * sqrt(q) log(q) over prime powers q^e of the order).
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto discrete_log(T base, T target, const UnsignedModder<T>& modder) -> std::optional<T>
+{
+    using UnsignedBigger = least_doubled_uint_t<T>;
+
+    const T p { modder.m() };
+    assert(base != 0 && base < p && target != 0 && target < p);
+
+    // Multiplicative order of `base`, and its factorization.
+    T order { static_cast<T>(p - 1U) };
+    std::vector<PrimePower<T>> order_factors { factorize(order) };
+    for (PrimePower<T>& factor : order_factors) {
+        while (factor.exponent != 0 && modder.pow_mod(base, order / factor.prime) == 1) {
+            order /= factor.prime;
+            --factor.exponent;
+        }
+    }
+
+    // x = result mod `modulus`, combined by the Chinese remainder theorem.
+    T result { 0 };
+    T modulus { 1 };
+    for (const auto [q, e] : order_factors) {
+        if (e == 0) {
+            continue;
+        }
+        T q_to_e { 1 };
+        for (unsigned i { 0 }; i != e; ++i) {
+            q_to_e *= q;
+        }
+        // Solve g^x = h in the subgroup of order q^e, one base-q digit of x at a time.
+        const T g { modder.pow_mod(base, order / q_to_e) };
+        const T h { modder.pow_mod(target, order / q_to_e) };
+        const T gamma { modder.pow_mod(g, q_to_e / q) }; // Order q.
+        T x { 0 };
+        T q_to_k { 1 };
+        for (unsigned k { 0 }; k != e; ++k) {
+            // (g^(-x) h)^(q^(e - 1 - k)) = gamma^(digit k of the true x).
+            const T g_to_minus_x { modder.pow_mod(g, (q_to_e - x) % q_to_e) };
+            const T h_k { modder.pow_mod(modder.times_mod(g_to_minus_x, h), q_to_e / q_to_k / q) };
+            const std::optional<T> digit { baby_step_giant_step(gamma, h_k, q, modder) };
+            if (!digit.has_value()) {
+                return std::nullopt;
+            }
+            x += static_cast<T>(*digit * q_to_k);
+            q_to_k *= q;
+        }
+
+        // result' = result (mod modulus), result' = x (mod q^e).
+        const UnsignedModder<T> sub_modder { q_to_e };
+        const T modulus_inverse { *inv_mod(sub_modder(modulus), sub_modder) };
+        const T t { sub_modder.times_mod(sub_modder.minus_mod(sub_modder(x), sub_modder(result)), modulus_inverse) };
+        result = static_cast<T>(result + static_cast<T>(static_cast<UnsignedBigger>(modulus) * t));
+        modulus *= q_to_e;
+    }
+
+    if (modder.pow_mod(base, result) != target) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Modular arithmetic with a compile-time modulus `M`.
+// When M == 0, the modulus mathematically equals (numeric_limits<T>::max() + 1).
+// Products are computed in the narrowest type that cannot overflow, so that the compiler
+// turns the reduction into a mask, or a multiplication and shifts.
+template <std::unsigned_integral T, T M>
+struct StaticModder {
+private:
+    static constexpr bool is_power_of_two_v { M == 0 || (M & (M - 1)) == 0 };
+
+    template <typename Work>
+    static constexpr bool fits_v { M != 0 && M - 1 <= (std::numeric_limits<Work>::max() - (M - 1)) / M };
+
+    [[nodiscard]] static constexpr auto work_type_chooser() noexcept
+    {
+        if constexpr (is_power_of_two_v) {
+            // Unsigned wraparound is exactly reduction modulo a power of two.
+            // At least `unsigned int`, so that small `T` is not promoted to `int`.
+            return std::common_type_t<T, unsigned int> {};
+        } else if constexpr (fits_v<unsigned int>) {
+            return std::common_type_t<T, unsigned int> {};
+        } else if constexpr (fits_v<unsigned long long>) {
+            return std::common_type_t<T, unsigned long long> {};
+        } else {
+            return least_doubled_uint_t<T> {};
+        }
+    }
+
+public:
+    // x * y + z does not overflow `work_type` for x, y, z in [0, M).
+    using work_type = decltype(work_type_chooser());
+
+    static constexpr T m { M };
+
+    [[nodiscard]] static constexpr auto reduce(work_type x) noexcept -> T
+    {
+        if constexpr (is_power_of_two_v) {
+            return static_cast<T>(x & static_cast<T>(M - 1));
+        } else {
+            return static_cast<T>(x % M);
+        }
+    }
+
+    [[nodiscard]] static constexpr auto mod(T x) noexcept -> T
+    {
+        return reduce(x);
+    }
+
+    // Require: x, y, z in [0, M).
+    [[nodiscard]] static constexpr auto times_plus_mod(T x, T y, T z) noexcept -> T
+    {
+        return reduce((static_cast<work_type>(x) * y) + z);
+    }
+};
+
+template <typename>
+struct std_lcg_traits;
+
+template <std::unsigned_integral UIntType, UIntType ax, UIntType cx, UIntType mx>
+struct std_lcg_traits<std::linear_congruential_engine<UIntType, ax, cx, mx>> {
+    using result_type = UIntType;
+    static constexpr UIntType a { ax };
+    static constexpr UIntType c { cx };
+    static constexpr UIntType m { mx };
+};
+
+template <typename T, typename UIntType>
+concept std_lcg_of = std::same_as<UIntType, typename std_lcg_traits<T>::result_type>;
+
+template <typename It, typename T>
+concept contiguous_iterator_of = std::contiguous_iterator<It> && std::same_as<std::iter_value_t<It>, T>;
+
+// Contiguous ranges of step counts of any built-in unsigned type up to 64 bits, since `std::uint64_t` is
+// `unsigned long` on some platforms and `unsigned long long` on others.
+template <typename R>
+concept step_count_range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+    && std::unsigned_integral<std::ranges::range_value_t<R>> && (sizeof(std::ranges::range_value_t<R>) <= sizeof(unsigned long long));
+
+// a^(-1) modulo m of a standard engine, or `std::nullopt` if its transform is not a bijection.
+template <std::unsigned_integral UIntType, UIntType a, UIntType m>
+constexpr inline std::optional<UIntType> std_lcg_a_inverse { inv_mod(a, UnsignedModder<UIntType> { m }) };
+
+// The state x of a standard engine whose next output is `output`: x = a^(-1) (output - c) (mod m).
+// Require: `std_lcg_a_inverse<UIntType, a, m>` has a value.
+template <std::unsigned_integral UIntType, UIntType a, UIntType c, UIntType m>
+[[nodiscard]] constexpr auto std_lcg_state_before(UIntType output) noexcept -> UIntType
+    requires(std_lcg_a_inverse<UIntType, a, m>.has_value())
+{
+    constexpr UnsignedModder<UIntType> modder { m };
+    return modder.times_mod(*std_lcg_a_inverse<UIntType, a, m>, modder.minus_mod(output, modder(c)));
+}
+
+// The state of a standard engine is only printable. Formatting and parsing it allocate, so, if f is a bijection,
+// the state is recovered from the next output of a copy instead, without allocating.
+template <std::unsigned_integral UIntType, UIntType a, UIntType c, UIntType m>
+[[nodiscard]] auto extract_state(const std::linear_congruential_engine<UIntType, a, c, m>& engine) noexcept(false) -> UIntType
+{
+    if constexpr (std_lcg_a_inverse<UIntType, a, m>.has_value()) {
+        std::linear_congruential_engine<UIntType, a, c, m> copy { engine };
+        return std_lcg_state_before<UIntType, a, c, m>(copy());
+    } else {
+        std::ostringstream oss {};
+        oss << engine;
+        std::istringstream iss { oss.str() };
+        UIntType state {};
+        iss >> state;
+        return state;
+    }
+}
+
+} // namespace ls_hower::lcg_predict::detail
+
+namespace ls_hower::lcg_predict {
+
+// What `UnsignedModder`, `LCGAffineTransform` and `LCGEngine` did, counted per thread when `LCG_PREDICT_INSTRUMENT`
+// is defined (in every translation unit of the program), and not at all otherwise.
+using LCGCounters = detail::InstrumentCounters;
+
+constexpr inline bool counters_enabled { detail::instrumented };
+
+// Returns: the counters of the calling thread. All zero without `LCG_PREDICT_INSTRUMENT`.
+[[nodiscard]] inline auto thread_counters() -> LCGCounters
+{
+#if defined(LCG_PREDICT_INSTRUMENT)
+    return detail::this_thread_counters().counters;
+#else
+    return LCGCounters {};
+#endif
+}
+
+// Returns: the sum of the counters of every thread, running or exited. All zero without `LCG_PREDICT_INSTRUMENT`.
+// The running threads keep counting while they are read, so the sum is a snapshot of each, not of all at once.
+[[nodiscard]] inline auto all_counters() -> LCGCounters
+{
+#if defined(LCG_PREDICT_INSTRUMENT)
+    detail::InstrumentRegistry& registry { detail::instrument_registry() };
+    const std::scoped_lock lock { registry.mutex };
+    LCGCounters result { registry.exited };
+    for (detail::ThreadCounters* running : registry.running) {
+        LCGCounters::zip(result, running->counters, [](std::uint64_t& total, std::uint64_t& counter) noexcept -> void {
+            total += std::atomic_ref<std::uint64_t> { counter }.load(std::memory_order_relaxed);
+        });
+    }
+    return result;
+#else
+    return LCGCounters {};
+#endif
+}
+
+template <detail::unsigned_integer_like UIntType>
+class LCGCycleStructure;
+
+template <detail::unsigned_integer_like UIntType>
+class LCGAffineTransform {
+    detail::UnsignedModder<UIntType> modder_;
+    UIntType a_;
+    UIntType c_;
+
+    // Lifts a solution modulo 2^j to 2^(j + 1), one bit at a time. With a odd, f is a bijection, and the period
+    // of the orbit of x modulo 2^(j + 1) is P or 2P, where P is the period modulo 2^j. So the solutions modulo
+    // 2^(j + 1) are among n and n + P, where n is the solution modulo 2^j.
+    [[nodiscard]] constexpr auto steps_between_power_of_two(UIntType x, UIntType y) const noexcept -> std::optional<unsigned long long>
+    {
+        constexpr int digits { std::numeric_limits<UIntType>::digits };
+        const int k { modder_.m() == 0 ? digits : detail::countr_zero(modder_.m()) };
+
+        if (a_ % 2 == 0) {
+            // a^n = 0 (mod 2^k) for n >= k, so f^n is the same constant map for every n >= k.
+            UIntType current { x };
+            for (int n { 0 }; n <= k; ++n, current = (*this)(current)) {
+                if (current == y) {
+                    return static_cast<unsigned long long>(n);
+                }
+            }
+            return std::nullopt;
+        }
+
+        unsigned long long n { 0 };
+        int period_log2 { 0 };
+        // f^(2^period_log2).
+        LCGAffineTransform period_power { *this };
+        UIntType current { x };
+        for (int j { 1 }; j <= k; ++j) {
+            const auto low_bits { static_cast<UIntType>(std::numeric_limits<UIntType>::max() >> (digits - j)) };
+            if (((current ^ y) & low_bits) != 0) {
+                current = period_power(current);
+                if (((current ^ y) & low_bits) != 0) {
+                    return std::nullopt;
+                }
+                n += 1ULL << period_log2;
+            }
+            if (j != k && ((period_power(current) ^ current) & low_bits) != 0) {
+                ++period_log2;
+                period_power.compose_assign(period_power);
+            }
+        }
+        return n;
+    }
+
+    // With a != 1, f has the fixed point u = c / (1 - a), and f^n(x) - u = a^n (x - u).
+    // So n is a discrete logarithm of (y - u) / (x - u) to the base a.
+    [[nodiscard]] constexpr auto steps_between_prime(UIntType x, UIntType y) const -> std::optional<unsigned long long>
+    {
+        if (x == y) {
+            return 0;
+        }
+        if (a_ == 0) {
+            return y == c_ ? std::optional<unsigned long long> { 1 } : std::nullopt;
+        }
+        if (a_ == 1) {
+            // f^n(x) = x + nc.
+            if (c_ == 0) {
+                return std::nullopt;
+            }
+            return modder_.times_mod(modder_.minus_mod(y, x), *detail::inv_mod(c_, modder_));
+        }
+
+        const UIntType fixed_point { modder_.times_mod(c_, *detail::inv_mod(modder_.minus_mod(1U, a_), modder_)) };
+        const UIntType from { modder_.minus_mod(x, fixed_point) };
+        const UIntType to { modder_.minus_mod(y, fixed_point) };
+        if (from == 0 || to == 0) {
+            return std::nullopt;
+        }
+        const std::optional<UIntType> n { detail::discrete_log(a_, modder_.times_mod(to, *detail::inv_mod(from, modder_)), modder_) };
+        return n.has_value() ? std::optional<unsigned long long> { *n } : std::nullopt;
+    }
+
+public:
+    using result_type = UIntType;
+
+    explicit constexpr LCGAffineTransform(UIntType a, UIntType c, UIntType m = 0) noexcept // NOLINT : order of triplet (a, c, m) is conventional, not easily swappable.
+        : modder_ { m }
+        , a_ { modder_(a) }
+        , c_ { modder_(c) }
+    {
+    }
+
+    template <typename StdEngine>
+    [[nodiscard]] static constexpr auto from_std() noexcept -> LCGAffineTransform
+        requires detail::std_lcg_of<std::remove_cvref_t<StdEngine>, UIntType>
+    {
+        using traits = detail::std_lcg_traits<std::remove_cvref_t<StdEngine>>;
+        return LCGAffineTransform { traits::a, traits::c, traits::m };
+    }
+
+    constexpr auto set_a(UIntType a) noexcept -> void { a_ = modder_(a); }
+    constexpr auto set_c(UIntType c) noexcept -> void { c_ = modder_(c); }
+    constexpr auto set_m(UIntType m) noexcept -> void { modder_.set_m(m); }
+    [[nodiscard]] constexpr auto a() const noexcept -> UIntType { return a_; }
+    [[nodiscard]] constexpr auto c() const noexcept -> UIntType { return c_; }
+    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return modder_.m(); }
+    [[nodiscard]] constexpr auto modder() const noexcept -> const detail::UnsignedModder<UIntType>& { return modder_; }
+
+    [[nodiscard]] constexpr auto operator()(result_type x) const noexcept -> result_type
+    {
+        return modder_.times_plus_mod(a_, x, c_);
+    }
+
+    // Writes f(in[i]) to out[i] for every i. `out` may be `in`, or overlap it starting later, but not earlier.
+    // Require: `in.size() == out.size()`.
+    constexpr auto apply_each(std::span<const result_type> in, std::span<result_type> out) const noexcept -> void
+    {
+        assert(in.size() == out.size());
+        if (modder_.kind() == detail::ReductionKind::mask) {
+            // Wrapping arithmetic is exact modulo a power of two, and the loop has no call to dispatch,
+            // so the compiler can vectorize it. `Work` is at least `unsigned int`, so that small `UIntType`
+            // is not promoted to `int`.
+            using Work = std::common_type_t<UIntType, unsigned int>;
+            const Work a { a_ };
+            const Work c { c_ };
+            const Work mask { static_cast<UIntType>(modder_.m() - 1U) };
+            for (std::size_t i { 0 }; i != in.size(); ++i) {
+                out[i] = static_cast<result_type>(((a * in[i]) + c) & mask);
+            }
+        } else {
+            for (std::size_t i { 0 }; i != in.size(); ++i) {
+                out[i] = (*this)(in[i]);
+            }
+        }
+    }
+
+    // Replaces values[i] by f(values[i]) for every i where `selected[i]`.
+    // Require: `values.size() == selected.size()`.
+    constexpr auto apply_each_if(std::span<result_type> values, std::span<const bool> selected) const noexcept -> void
+    {
+        assert(values.size() == selected.size());
+        if (modder_.kind() == detail::ReductionKind::mask) {
+            // Computed for every value and then selected, so that the loop has no branch, as in `apply_each`.
+            using Work = std::common_type_t<UIntType, unsigned int>;
+            const Work a { a_ };
+            const Work c { c_ };
+            const Work mask { static_cast<UIntType>(modder_.m() - 1U) };
+            for (std::size_t i { 0 }; i != values.size(); ++i) {
+                const auto stepped { static_cast<result_type>(((a * values[i]) + c) & mask) };
+                values[i] = selected[i] ? stepped : values[i];
+            }
+        } else {
+            for (std::size_t i { 0 }; i != values.size(); ++i) {
+                if (selected[i]) {
+                    values[i] = (*this)(values[i]);
+                }
+            }
+        }
+    }
+
+    constexpr auto operator+=(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    {
+        assert(modder_ == rhs.modder_);
+        a_ = modder_.plus_mod(a_, rhs.a_);
+        c_ = modder_.plus_mod(c_, rhs.c_);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr auto operator+(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+    {
+        lhs += rhs;
+        return lhs;
+    }
+
+    constexpr auto operator-=(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    {
+        assert(modder_ == rhs.modder_);
+        a_ = modder_.minus_mod(a_, rhs.a_);
+        c_ = modder_.minus_mod(c_, rhs.c_);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr auto operator-(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+    {
+        lhs -= rhs;
+        return lhs;
+    }
+
+    constexpr auto compose_assign(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    {
+        assert(modder_ == rhs.modder_);
+        detail::instrument_count(&detail::InstrumentCounters::compose_assign);
+        const UIntType new_a { modder_.times_mod(a_, rhs.a_) };
+        const UIntType new_c { modder_.times_plus_mod(a_, rhs.c_, c_) };
+        a_ = new_a;
+        c_ = new_c;
+        return *this;
+    }
+
+    // Returns f such that f(x) = lhs(rhs(x)).
+    [[nodiscard]] friend constexpr auto compose(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+    {
+        lhs.compose_assign(rhs);
+        return lhs;
+    }
+
+    [[nodiscard]] constexpr auto identity() const noexcept -> LCGAffineTransform
+    {
+        // Copy the modder rather than constructing it again, which would recompute its reciprocal.
+        LCGAffineTransform result { *this };
+        result.a_ = modder_(1U);
+        result.c_ = 0;
+        return result;
+    }
+
+    // Returns g such that g(f(x)) = f(g(x)) = x, where f is `*this`, or `std::nullopt` if gcd(a, m) != 1.
+    // g(y) = a^(-1) * (y - c).
+    // Time complexity: O(log(m)).
+    [[nodiscard]] constexpr auto inverse() const noexcept -> std::optional<LCGAffineTransform>
+    {
+        const std::optional<UIntType> a_inverse { detail::inv_mod(a_, modder_) };
+        if (!a_inverse.has_value()) {
+            return std::nullopt;
+        }
+        LCGAffineTransform result { *this };
+        result.a_ = *a_inverse;
+        result.c_ = modder_.times_mod(*a_inverse, modder_.minus_mod(0U, c_));
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto powered(unsigned long long n) const noexcept -> LCGAffineTransform
+    {
+        detail::instrument_distance(&detail::InstrumentCounters::powered_distances, n);
+        // Use ADL to find the hidden friend `compose`.
+        const auto composer {
+            [](const LCGAffineTransform& lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform {
+                return compose(lhs, rhs);
+            }
+        };
+        return detail::double_and_add(*this, n, composer, this->identity());
+    }
+
+    // Same as `powered(unsigned long long)`, for counts wider than 64 bits, as with the periods of 128-bit moduli.
+    template <detail::wide_unsigned_integer_like N>
+    [[nodiscard]] constexpr auto powered(const N& n) const noexcept -> LCGAffineTransform
+    {
+        detail::instrument_distance(&detail::InstrumentCounters::powered_distances, n);
+        const auto composer {
+            [](const LCGAffineTransform& lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform {
+                return compose(lhs, rhs);
+            }
+        };
+        return detail::double_and_add(*this, n, composer, this->identity());
+    }
+
+    // Returns the least n such that f^n(x) = y, or `std::nullopt` if there is none.
+    // Require: m is 0, a power of two, or a prime.
+    // Require: `result_type` be a built-in integer, so that the answer fits in `unsigned long long`.
+    // Time complexity: O(log(m)^2) if m is 0 or a power of two. Otherwise, dominated by factorizing m - 1,
+    // and by O(sqrt(q)) for the largest prime factor q of the multiplicative order of a.
+    [[nodiscard]] constexpr auto steps_between(result_type x, result_type y) const -> std::optional<unsigned long long>
+        requires std::unsigned_integral<UIntType>
+    {
+        x = modder_(x);
+        y = modder_(y);
+        if (modder_.kind() == detail::ReductionKind::mask) {
+            return this->steps_between_power_of_two(x, y);
+        }
+        assert(detail::is_prime(modder_.m()));
+        return this->steps_between_prime(x, y);
+    }
+
+    // Same result as `LCGCycleStructure { *this }.period()`.
+    // Build an `LCGCycleStructure` once instead for several queries: this factorizes m every time.
+    [[nodiscard]] constexpr auto period() const -> detail::least_doubled_uint_t<UIntType>
+        requires std::unsigned_integral<UIntType>
+    {
+        return LCGCycleStructure<UIntType> { *this }.period();
+    }
+
+    // Same result as `LCGCycleStructure { *this }.cycle_length(x)`.
+    [[nodiscard]] constexpr auto cycle_length(result_type x) const -> detail::least_doubled_uint_t<UIntType>
+        requires std::unsigned_integral<UIntType>
+    {
+        return LCGCycleStructure<UIntType> { *this }.cycle_length(x);
+    }
+
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return c_ == 0U ? 1U : 0U; }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return modder_.m() - 1U; }
+    [[nodiscard]] friend constexpr auto operator==(const LCGAffineTransform& lhs, const LCGAffineTransform& rhs) noexcept -> bool = default;
+};
+
+// The transform f^n of an `LCGAffineTransform` f, together with the sums of the values it passes through.
+// For a start x, with x_i = f^i(x) and f^n(x) = a x + c:
+//     x_1 + ... + x_n = p x + q,
+//     x_1^2 + ... + x_n^2 = r x^2 + u x + v, only tracked with `Degree` == 2,
+// all modulo m. These compose like f^n does, so `powered` gives the sums of n values in O(log(n)) compositions,
+// through `detail::double_and_add`.
+// The sums are modulo m, or modulo 2^digits when m == 0. The exact sums over the integers are not determined:
+// every step discards the quotient of its reduction.
+template <detail::unsigned_integer_like UIntType, unsigned Degree = 1>
+    requires (Degree == 1 || Degree == 2)
+class LCGAffineSums {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+
+private:
+    affine_type affine_;
+    UIntType p_;
+    UIntType q_;
+    UIntType r_;
+    UIntType u_;
+    UIntType v_;
+
+    [[nodiscard]] constexpr auto modder() const noexcept -> const detail::UnsignedModder<UIntType>&
+    {
+        return affine_.modder();
+    }
+
+public:
+    // The sums of one step of f: x_1 = a x + c, and x_1^2 = a^2 x^2 + 2ac x + c^2.
+    explicit constexpr LCGAffineSums(const affine_type& affine) noexcept
+        : affine_ { affine }
+        , p_ { affine.a() }
+        , q_ { affine.c() }
+        , r_ { 0 }
+        , u_ { 0 }
+        , v_ { 0 }
+    {
+        if constexpr (Degree == 2) {
+            const detail::UnsignedModder<UIntType>& modder { this->modder() };
+            r_ = modder.times_mod(p_, p_);
+            u_ = modder.times_mod(modder.plus_mod(p_, p_), q_);
+            v_ = modder.times_mod(q_, q_);
+        }
+    }
+
+    // The sums of no step.
+    [[nodiscard]] constexpr auto identity() const noexcept -> LCGAffineSums
+    {
+        LCGAffineSums result { *this };
+        result.affine_ = affine_.identity();
+        result.p_ = result.q_ = result.r_ = result.u_ = result.v_ = 0;
+        return result;
+    }
+
+    // Makes `*this` the sums of the steps of `rhs` followed by the steps of `*this`.
+    // With y = rhs.affine()(x), the values of `*this` from y add p y + q and r y^2 + u y + v.
+    constexpr auto compose_assign(const LCGAffineSums& rhs) noexcept -> LCGAffineSums&
+    {
+        assert(this->modder() == rhs.modder());
+        const detail::UnsignedModder<UIntType>& modder { this->modder() };
+        const UIntType a { rhs.affine_.a() };
+        const UIntType c { rhs.affine_.c() };
+        if constexpr (Degree == 2) {
+            const UIntType rc { modder.times_mod(r_, c) };
+            const UIntType new_r { modder.times_plus_mod(r_, modder.times_mod(a, a), rhs.r_) };
+            const UIntType new_u { modder.times_plus_mod(a, modder.plus_mod(rc, rc, u_), rhs.u_) };
+            const UIntType new_v { modder.plus_mod(modder.times_plus_mod(c, modder.plus_mod(rc, u_), rhs.v_), v_) };
+            r_ = new_r;
+            u_ = new_u;
+            v_ = new_v;
+        }
+        const UIntType new_p { modder.times_plus_mod(p_, a, rhs.p_) };
+        const UIntType new_q { modder.times_plus_plus_mod(p_, c, rhs.q_, q_) };
+        p_ = new_p;
+        q_ = new_q;
+        affine_.compose_assign(rhs.affine_);
+        return *this;
+    }
+
+    // Returns the sums of the steps of `rhs` followed by the steps of `lhs`.
+    [[nodiscard]] friend constexpr auto compose(LCGAffineSums lhs, const LCGAffineSums& rhs) noexcept -> LCGAffineSums
+    {
+        lhs.compose_assign(rhs);
+        return lhs;
+    }
+
+    // Returns the sums of n times as many steps.
+    // Time complexity: O(log(n)).
+    [[nodiscard]] constexpr auto powered(unsigned long long n) const noexcept -> LCGAffineSums
+    {
+        const auto composer {
+            [](const LCGAffineSums& lhs, const LCGAffineSums& rhs) noexcept -> LCGAffineSums {
+                return compose(lhs, rhs);
+            }
+        };
+        return detail::double_and_add(*this, n, composer, this->identity());
+    }
+
+    // Same as `powered(unsigned long long)`, for counts wider than 64 bits.
+    template <detail::wide_unsigned_integer_like N>
+    [[nodiscard]] constexpr auto powered(const N& n) const noexcept -> LCGAffineSums
+    {
+        const auto composer {
+            [](const LCGAffineSums& lhs, const LCGAffineSums& rhs) noexcept -> LCGAffineSums {
+                return compose(lhs, rhs);
+            }
+        };
+        return detail::double_and_add(*this, n, composer, this->identity());
+    }
+
+    // The transform f^n.
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+
+    // Returns x_1 + ... + x_n, modulo m.
+    [[nodiscard]] constexpr auto sum(result_type x) const noexcept -> result_type
+    {
+        return this->modder().times_plus_mod(p_, this->modder()(x), q_);
+    }
+
+    // Returns x_1^2 + ... + x_n^2, modulo m.
+    [[nodiscard]] constexpr auto sum_of_squares(result_type x) const noexcept -> result_type
+        requires (Degree == 2)
+    {
+        const detail::UnsignedModder<UIntType>& modder { this->modder() };
+        x = modder(x);
+        return modder.times_plus_mod(modder.times_plus_mod(r_, x, u_), x, v_);
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGAffineSums& lhs, const LCGAffineSums& rhs) noexcept -> bool = default;
+};
+
+// Precomputed powers of an `LCGAffineTransform`, for many jumps with the same transform.
+// Stores f^(j * 2^(WindowBits * i)) for every digit position i and every nonzero digit j of radix 2^WindowBits.
+// `WindowBits` == 1 gives the binary table f^(2^i).
+// A jump costs one composition per nonzero digit of `n`, and no squaring.
+// The table only jumps forwards: `inverse_table` builds the table of f^(-1) when backward jumps are needed.
+// f^(-1) itself is computed with the table, so backward jumps through the table need no inverse modulo m.
+// The powers are stored inline, 2^WindowBits - 1 per digit, 240 transforms for `WindowBits` == 4, so a wider window
+// would no longer fit on a stack.
+template <detail::unsigned_integer_like UIntType, unsigned WindowBits = 1>
+    requires (WindowBits >= 1 && WindowBits <= 4)
+class LCGJumpTable {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    static constexpr unsigned window_bits { WindowBits };
+    static constexpr std::size_t digit_count { (std::numeric_limits<unsigned long long>::digits + WindowBits - 1) / WindowBits };
+    static constexpr std::size_t entries_per_digit { (std::size_t { 1 } << WindowBits) - 1 };
+
+private:
+    using powers_type = std::array<affine_type, digit_count * entries_per_digit>;
+
+    static constexpr unsigned long long digit_mask { (1ULL << WindowBits) - 1 };
+
+    affine_type affine_;
+    // `affine_.inverse()`, or `std::nullopt` if f is not invertible.
+    std::optional<affine_type> inverse_;
+    // powers_[i * entries_per_digit + (j - 1)] is f^(j * 2^(WindowBits * i)).
+    powers_type powers_;
+
+    [[nodiscard]] static constexpr auto make_powers(const affine_type& affine) noexcept -> powers_type
+    {
+        const auto generator {
+            [base = affine, power = affine, j = std::size_t { 1 }]() mutable noexcept -> affine_type {
+                const affine_type result { power };
+                if (j == entries_per_digit) {
+                    // base^(2^WindowBits) = base^(2^WindowBits - 1) o base.
+                    base = compose(power, base);
+                    power = base;
+                    j = 1;
+                } else {
+                    power = compose(power, base);
+                    ++j;
+                }
+                return result;
+            }
+        };
+        return detail::generate_array<digit_count * entries_per_digit>(generator);
+    }
+
+    // Require: `inverse` be `affine.inverse()`.
+    constexpr LCGJumpTable(const affine_type& affine, const std::optional<affine_type>& inverse) noexcept
+        : affine_ { affine }
+        , inverse_ { inverse }
+        , powers_ { make_powers(affine) }
+    {
+    }
+
+public:
+    explicit constexpr LCGJumpTable(const affine_type& affine) noexcept
+        : LCGJumpTable { affine, affine.inverse() }
+    {
+    }
+
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+
+    // Same as `affine().inverse()`, computed once with the table.
+    [[nodiscard]] constexpr auto inverse() const noexcept -> const std::optional<affine_type>& { return inverse_; }
+
+    // Returns the table of `affine().inverse()`, for backward jumps, or `std::nullopt` if f is not invertible.
+    // Time complexity: the same as the constructor, without computing any inverse.
+    [[nodiscard]] constexpr auto inverse_table() const noexcept -> std::optional<LCGJumpTable>
+    {
+        if (!inverse_.has_value()) {
+            return std::nullopt;
+        }
+        return LCGJumpTable { *inverse_, affine_ };
+    }
+
+    // Returns f^(digit * 2^(WindowBits * digit_index)).
+    // Require: 0 < digit < 2^WindowBits, digit_index < digit_count.
+    [[nodiscard]] constexpr auto power(std::size_t digit_index, unsigned long long digit) const noexcept -> const affine_type&
+    {
+        assert(digit_index < digit_count);
+        assert(digit != 0 && digit <= digit_mask);
+        return powers_[(digit_index * entries_per_digit) + static_cast<std::size_t>(digit - 1)];
+    }
+
+    // Same result as `affine().powered(n)`.
+    // Time complexity: O(number of nonzero digits of n).
+    [[nodiscard]] constexpr auto powered(unsigned long long n) const noexcept -> affine_type
+    {
+        affine_type result { affine_.identity() };
+        for (std::size_t i { 0 }; n != 0; ++i, n >>= WindowBits) {
+            if (const unsigned long long digit { n & digit_mask }; digit != 0) {
+                result.compose_assign(this->power(i, digit));
+            }
+        }
+        return result;
+    }
+
+    // Same result as `affine().powered(n)(x)`, without composing transforms.
+    // Powers of the same transform commute, so digits are applied from the lowest one.
+    [[nodiscard]] constexpr auto advance(result_type x, unsigned long long n) const noexcept -> result_type
+    {
+        for (std::size_t i { 0 }; n != 0; ++i, n >>= WindowBits) {
+            if (const unsigned long long digit { n & digit_mask }; digit != 0) {
+                x = this->power(i, digit)(x);
+            }
+        }
+        return x;
+    }
+};
+
+// The cycles of an `LCGAffineTransform` f, from the factorization of m, for many queries with the same transform.
+// By the Chinese remainder theorem, f is the product of its reductions f_i modulo the prime powers p^e of m, and
+// the cycle of a sequence of f has the least common multiple of the lengths of the cycles of the f_i.
+// If p divides a, f_i takes every residue to its unique fixed point within e steps.
+// Otherwise, f_i is a bijection, whose order divides (p - 1) p^e: the least n such that f_i^n is the identity is
+// found by removing prime factors from (p - 1) p^e while it stays so. By the Hull-Dobell theorem, f_i is a single
+// cycle of length p^e if a = 1 (mod p), also (mod 4) if p = 2 and e >= 2, and c != 0 (mod p), with no powering.
+template <detail::unsigned_integer_like UIntType>
+class LCGCycleStructure {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    // Lengths are at most 2^digits, reached when m == 0.
+    using period_type = detail::least_doubled_uint_t<UIntType>;
+
+private:
+    using factorization_type = std::vector<detail::PrimePower<UIntType>>;
+
+    struct Component {
+        // f modulo p^e.
+        affine_type affine;
+        UIntType prime;
+        unsigned exponent;
+        // Whether f modulo p^e is a single cycle, by the Hull-Dobell theorem.
+        bool full;
+        // The order of f modulo p^e, which is 1 if p divides a.
+        factorization_type order;
+    };
+
+    affine_type affine_;
+    std::vector<Component> components_;
+    period_type period_;
+
+    [[nodiscard]] static constexpr auto product(const factorization_type& factors) noexcept -> period_type
+    {
+        period_type result { 1U };
+        for (const auto [prime, exponent] : factors) {
+            for (unsigned i { 0 }; i != exponent; ++i) {
+                result *= prime;
+            }
+        }
+        return result;
+    }
+
+    // Raises the exponents of `lcm` to those of `factors`, for the least common multiple of their products.
+    static constexpr auto merge_lcm(factorization_type& lcm, const factorization_type& factors) -> void
+    {
+        for (const detail::PrimePower<UIntType>& factor : factors) {
+            const auto found { std::ranges::find(lcm, factor.prime, &detail::PrimePower<UIntType>::prime) };
+            if (found == lcm.end()) {
+                lcm.push_back(factor);
+            } else {
+                found->exponent = std::max(found->exponent, factor.exponent);
+            }
+        }
+    }
+
+    // Returns the least n such that `holds(f^n)`, given the factorization of a multiple of it for which it holds,
+    // and that it holds exactly for the multiples of n.
+    // Time complexity: O(sum of exponents of `factors`) calls of `powered`.
+    template <typename Holds>
+    [[nodiscard]] static constexpr auto least_order(const affine_type& f, factorization_type factors, Holds holds) -> factorization_type
+    {
+        period_type n { product(factors) };
+        for (detail::PrimePower<UIntType>& factor : factors) {
+            while (factor.exponent != 0 && holds(f.powered(n / factor.prime))) {
+                n /= factor.prime;
+                --factor.exponent;
+            }
+        }
+        std::erase_if(factors, [](const detail::PrimePower<UIntType>& factor) noexcept -> bool { return factor.exponent == 0; });
+        return factors;
+    }
+
+    // Same as `least_order`, for a power of two 2^k with k <= `exponent`, by squaring.
+    // Time complexity: O(exponent).
+    template <typename Holds>
+    [[nodiscard]] static constexpr auto least_power_of_two_order(const affine_type& f, unsigned exponent, Holds holds) -> factorization_type
+    {
+        affine_type power { f };
+        for (unsigned k { 0 }; k != exponent; ++k) {
+            if (holds(power)) {
+                if (k == 0) {
+                    return {};
+                }
+                return { { 2U, k } };
+            }
+            power.compose_assign(power);
+        }
+        return { { 2U, exponent } };
+    }
+
+    template <typename Holds>
+    [[nodiscard]] static constexpr auto component_order(const Component& component, Holds holds) -> factorization_type
+    {
+        if (component.prime == 2) {
+            return least_power_of_two_order(component.affine, component.exponent, holds);
+        }
+        return least_order(component.affine, component.order, holds);
+    }
+
+    [[nodiscard]] static constexpr auto make_component(const affine_type& f, UIntType p, unsigned e) -> Component
+    {
+        Component component { f, p, e, false, {} };
+        const UIntType a { f.a() };
+        if (a % p == 0) {
+            return component;
+        }
+        const UIntType a_minus_1 { static_cast<UIntType>(a - 1U) };
+        component.full = f.c() % p != 0 && a_minus_1 % p == 0 && (p != 2 || e < 2 || a_minus_1 % 4 == 0);
+        if (component.full) {
+            component.order = { { p, e } };
+            return component;
+        }
+        // f^((p - 1) p^e) is the identity.
+        if (p != 2) {
+            component.order = detail::factorize(static_cast<UIntType>(p - 1U));
+        }
+        component.order.push_back({ p, e });
+        const affine_type identity { f.identity() };
+        component.order = component_order(component, [&identity](const affine_type& power) noexcept -> bool { return power == identity; });
+        return component;
+    }
+
+    [[nodiscard]] static constexpr auto make_components(const affine_type& affine) -> std::vector<Component>
+    {
+        const UIntType m { affine.m() };
+        factorization_type m_factors {};
+        if (m == 0) {
+            m_factors.push_back({ 2U, static_cast<unsigned>(std::numeric_limits<UIntType>::digits) });
+        } else if (m != 1) {
+            m_factors = detail::factorize(m);
+        }
+        std::vector<Component> components {};
+        for (const auto [p, e] : m_factors) {
+            // p^e, or 0 for 2^digits.
+            UIntType q { 1 };
+            for (unsigned i { 0 }; i != e; ++i) {
+                q = static_cast<UIntType>(q * p);
+            }
+            components.push_back(make_component(affine_type { affine.a(), affine.c(), q }, p, e));
+        }
+        return components;
+    }
+
+    [[nodiscard]] static constexpr auto make_period(const std::vector<Component>& components) -> period_type
+    {
+        factorization_type lcm {};
+        for (const Component& component : components) {
+            merge_lcm(lcm, component.order);
+        }
+        return product(lcm);
+    }
+
+public:
+    // Time complexity: dominated by factorizing m, and p - 1 for every prime p dividing m but not a.
+    explicit constexpr LCGCycleStructure(const affine_type& affine)
+        requires std::unsigned_integral<UIntType>
+        : affine_ { affine }
+        , components_ { make_components(affine) }
+        , period_ { make_period(components_) }
+    {
+    }
+
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+
+    // Returns the length of the longest cycle of f, which the length of every other cycle divides.
+    // With gcd(a, m) == 1, it is the least n > 0 such that f^n is the identity.
+    // It is m (2^digits when m == 0) exactly when the Hull-Dobell theorem holds, i.e., f is a single cycle.
+    [[nodiscard]] constexpr auto period() const noexcept -> period_type { return period_; }
+
+    // Returns the length of the cycle that the sequence from `x` enters: the least n > 0 such that
+    // f^(t + n)(x) = f^t(x) for some t. With gcd(a, m) == 1, t = 0, and the sequence repeats `x` itself.
+    // Time complexity: O(log(m)) calls of `powered` for every prime power of m whose f_i is not a single cycle.
+    [[nodiscard]] constexpr auto cycle_length(result_type x) const -> period_type
+    {
+        factorization_type lcm {};
+        for (const Component& component : components_) {
+            if (component.full || component.order.empty()) {
+                merge_lcm(lcm, component.order);
+                continue;
+            }
+            const UIntType residue { component.affine.modder()(x) };
+            merge_lcm(lcm, component_order(component, [residue](const affine_type& power) noexcept -> bool { return power(residue) == residue; }));
+        }
+        return product(lcm);
+    }
+};
+
+// The parameters of an `LCGSubstream`, in a form that can be sent to another process.
+// Trivially copyable, so it may be sent as raw bytes between machines of the same endianness.
+// Its text form is "a c m next", separated by spaces, like the text form of standard engines.
+template <detail::unsigned_integer_like UIntType>
+struct LCGSubstreamDescriptor {
+    UIntType a;
+    UIntType c;
+    UIntType m;
+    UIntType next;
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGSubstreamDescriptor& lhs, const LCGSubstreamDescriptor& rhs) noexcept -> bool = default;
+
+    template <typename CharT, typename Traits>
+    friend auto operator<<(std::basic_ostream<CharT, Traits>& os, const LCGSubstreamDescriptor& descriptor) -> std::basic_ostream<CharT, Traits>&
+    {
+        const CharT space { os.widen(' ') };
+        return os << descriptor.a << space << descriptor.c << space << descriptor.m << space << descriptor.next;
+    }
+
+    template <typename CharT, typename Traits>
+    friend auto operator>>(std::basic_istream<CharT, Traits>& is, LCGSubstreamDescriptor& descriptor) -> std::basic_istream<CharT, Traits>&
+    {
+        LCGSubstreamDescriptor result {};
+        if (is >> result.a >> result.c >> result.m >> result.next) {
+            descriptor = result;
+        }
+        return is;
+    }
+};
+
+// A share of the sequence of an `LCGEngine`: every `stride`-th value, starting from `next`.
+// Made by `LCGEngine::split_block` and `LCGEngine::split_leapfrog`.
+template <detail::unsigned_integer_like UIntType>
+class LCGSubstream {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    using descriptor_type = LCGSubstreamDescriptor<UIntType>;
+
+private:
+    affine_type stride_;
+    result_type next_;
+
+public:
+    // `stride` maps each value of the substream to the following one, and `next` is the value returned by the next `operator()`.
+    explicit constexpr LCGSubstream(affine_type stride, result_type next) noexcept
+        : stride_ { stride }
+        , next_ { stride_.modder()(next) }
+    {
+    }
+
+    explicit constexpr LCGSubstream(const descriptor_type& descriptor) noexcept
+        : LCGSubstream { affine_type { descriptor.a, descriptor.c, descriptor.m }, descriptor.next }
+    {
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        const result_type result { next_ };
+        next_ = stride_(next_);
+        return result;
+    }
+
+    // Time complexity: O(log(n)).
+    constexpr auto discard(unsigned long long n) noexcept -> void
+    {
+        next_ = stride_.powered(n)(next_);
+    }
+
+    [[nodiscard]] constexpr auto stride() const noexcept -> affine_type { return stride_; }
+    [[nodiscard]] constexpr auto next() const noexcept -> result_type { return next_; }
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return stride_.min(); }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return stride_.max(); }
+
+    [[nodiscard]] constexpr auto descriptor() const noexcept -> descriptor_type
+    {
+        return descriptor_type { stride_.a(), stride_.c(), stride_.m(), next_ };
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGSubstream& lhs, const LCGSubstream& rhs) noexcept -> bool = default;
+};
+
+// The values of an `LCGEngine`'s calls of `operator()` numbered [first, last), counting the next call as 0, computed
+// on demand. Made by `LCGEngine::sequence`.
+// Iterators hold a copy of the transform and of the engine's state, so they outlive the view, which is borrowed.
+// Stepping forwards is one application of the transform; any other move jumps with `powered`, in O(log(n)).
+template <detail::unsigned_integer_like UIntType>
+class LCGSequenceView : public std::ranges::view_interface<LCGSequenceView<UIntType>> {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+
+    class iterator {
+        affine_type affine_ { 1U, 0U };
+        // The engine's state, from which value i is f^(i + 1)(seed_).
+        result_type seed_ {};
+        unsigned long long index_ { 0 };
+        result_type value_ {};
+
+    public:
+        // Values are computed, not stored, so `operator*` returns them by value, as `std::views::iota` does.
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = result_type;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr iterator(const affine_type& affine, result_type seed, unsigned long long index) noexcept
+            : affine_ { affine }
+            , seed_ { seed }
+            , index_ { index }
+            , value_ { affine.powered(index + 1)(seed) }
+        {
+        }
+
+        [[nodiscard]] constexpr auto index() const noexcept -> unsigned long long { return index_; }
+        [[nodiscard]] constexpr auto operator*() const noexcept -> result_type { return value_; }
+
+    private:
+        constexpr auto advance(unsigned long long n) noexcept -> iterator&
+        {
+            index_ += n;
+            value_ = affine_.powered(n)(value_);
+            return *this;
+        }
+
+        constexpr auto retreat(unsigned long long n) noexcept -> iterator&
+        {
+            assert(n <= index_);
+            index_ -= n;
+            value_ = affine_.powered(index_ + 1)(seed_);
+            return *this;
+        }
+
+    public:
+        [[nodiscard]] constexpr auto operator[](difference_type n) const noexcept -> result_type
+        {
+            return *(*this + n);
+        }
+
+        constexpr auto operator++() noexcept -> iterator&
+        {
+            ++index_;
+            value_ = affine_(value_);
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator
+        {
+            iterator result { *this };
+            ++*this;
+            return result;
+        }
+
+        // Time complexity: O(log(index())).
+        constexpr auto operator--() noexcept -> iterator& { return *this -= 1; }
+
+        constexpr auto operator--(int) noexcept -> iterator
+        {
+            iterator result { *this };
+            --*this;
+            return result;
+        }
+
+        // Forwards, jumps from the current value; backwards, from the seed, since f may not be invertible.
+        // Time complexity: O(log(n)) forwards, O(log(index() + n)) backwards.
+        constexpr auto operator+=(difference_type n) noexcept -> iterator&
+        {
+            return n >= 0 ? this->advance(detail::magnitude(n)) : this->retreat(detail::magnitude(n));
+        }
+
+        constexpr auto operator-=(difference_type n) noexcept -> iterator&
+        {
+            return n >= 0 ? this->retreat(detail::magnitude(n)) : this->advance(detail::magnitude(n));
+        }
+
+        [[nodiscard]] friend constexpr auto operator+(iterator it, difference_type n) noexcept -> iterator { return it += n; }
+        [[nodiscard]] friend constexpr auto operator+(difference_type n, iterator it) noexcept -> iterator { return it += n; }
+        [[nodiscard]] friend constexpr auto operator-(iterator it, difference_type n) noexcept -> iterator { return it -= n; }
+
+        // Require: both iterators come from the same view, less than `std::numeric_limits<difference_type>::max()` apart.
+        [[nodiscard]] friend constexpr auto operator-(const iterator& lhs, const iterator& rhs) noexcept -> difference_type
+        {
+            return lhs.index_ >= rhs.index_ ? static_cast<difference_type>(lhs.index_ - rhs.index_) : -static_cast<difference_type>(rhs.index_ - lhs.index_);
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(const iterator& lhs, const iterator& rhs) noexcept -> bool { return lhs.index_ == rhs.index_; }
+        [[nodiscard]] friend constexpr auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept -> std::strong_ordering { return lhs.index_ <=> rhs.index_; }
+    };
+
+private:
+    affine_type affine_ { 1U, 0U };
+    result_type seed_ {};
+    unsigned long long first_ { 0 };
+    unsigned long long last_ { 0 };
+
+public:
+    constexpr LCGSequenceView() noexcept = default;
+
+    // The values f^(i + 1)(seed) for i in [first, last).
+    // Require: first <= last.
+    constexpr LCGSequenceView(const affine_type& affine, result_type seed, unsigned long long first, unsigned long long last) noexcept
+        : affine_ { affine }
+        , seed_ { affine.modder()(seed) }
+        , first_ { first }
+        , last_ { last }
+    {
+        assert(first <= last);
+    }
+
+    // Time complexity: O(log(first)).
+    [[nodiscard]] constexpr auto begin() const noexcept -> iterator { return iterator { affine_, seed_, first_ }; }
+    // Time complexity: O(log(last)).
+    [[nodiscard]] constexpr auto end() const noexcept -> iterator { return iterator { affine_, seed_, last_ }; }
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return static_cast<std::size_t>(last_ - first_); }
+
+    // Same as `begin()[n]`, with one jump instead of two.
+    // Time complexity: O(log(first + n)).
+    [[nodiscard]] constexpr auto operator[](std::size_t n) const noexcept -> result_type
+    {
+        assert(n < this->size());
+        return affine_.powered(first_ + n + 1)(seed_);
+    }
+
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+    [[nodiscard]] constexpr auto first() const noexcept -> unsigned long long { return first_; }
+    [[nodiscard]] constexpr auto last() const noexcept -> unsigned long long { return last_; }
+};
+
+template <detail::unsigned_integer_like UIntType>
+class LCGEngine {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+
+private:
+    affine_type affine_;
+    result_type state_;
+
+    [[nodiscard]] constexpr auto modder() const noexcept -> const detail::UnsignedModder<UIntType>&
+    {
+        return affine_.modder();
+    }
+
+protected:
+    // Counts a jump of `distance` steps, with `LCG_PREDICT_INSTRUMENT` defined.
+    template <detail::unsigned_integer_like N>
+    static constexpr auto instrument_jump(const N& distance, bool backward, bool through_table) noexcept -> void
+    {
+        detail::instrument_distance(&detail::InstrumentCounters::jump_distances, distance);
+        if (backward) {
+            detail::instrument_count(&detail::InstrumentCounters::backward_jumps);
+        }
+        if (through_table) {
+            detail::instrument_count(&detail::InstrumentCounters::table_jumps);
+        }
+    }
+
+public:
+    // Number of independent chains used by `generate`: one 64-byte vector register of `result_type`.
+    static constexpr std::size_t generation_lanes { std::max<std::size_t>(4, 64 / sizeof(UIntType)) };
+    // From this many indices, `values_at` without a table builds one. Building a radix-16 table costs about as much
+    // as 6 to 20 `powered` of 40-bit distances, depending on the reduction, so smaller batches take a `powered` each.
+    static constexpr std::size_t values_at_min_table_size { 12 };
+    static constexpr UIntType default_seed { 1U };
+
+    explicit constexpr LCGEngine(affine_type affine, result_type state = default_seed) noexcept
+        : affine_ { affine }
+        , state_ { this->modder()(state) }
+    {
+    }
+
+    explicit constexpr LCGEngine(UIntType a, UIntType c, UIntType m = 0, result_type state = default_seed) noexcept
+        : LCGEngine { affine_type { a, c, m }, state }
+    {
+    }
+
+    // Operations on `std::linear_congruential_engine` are not `constexpr`.
+    // So the factory function is not `constexpr`.
+    template <typename StdEngine>
+    [[nodiscard]] static auto from_std(StdEngine engine) noexcept(false) -> LCGEngine
+        requires detail::std_lcg_of<std::remove_cvref_t<StdEngine>, UIntType>
+    {
+        return LCGEngine {
+            affine_type::template from_std<std::remove_cvref_t<StdEngine>>(),
+            detail::extract_state(engine),
+        };
+    }
+
+    // Converts `engines[i]` to `out[i]`, as `from_std` does each.
+    // Require: `engines.size() == out.size()`.
+    template <typename StdEngine>
+    static auto from_std(std::span<const StdEngine> engines, std::span<LCGEngine> out) noexcept(false) -> void
+        requires detail::std_lcg_of<StdEngine, UIntType>
+    {
+        assert(engines.size() == out.size());
+        const affine_type affine { affine_type::template from_std<StdEngine>() };
+        for (std::size_t i { 0 }; i != engines.size(); ++i) {
+            out[i] = LCGEngine { affine, detail::extract_state(engines[i]) };
+        }
+    }
+
+    // The standard engine whose next output is the next output of `*this`.
+    // Require: `affine() == affine_type::from_std<StdEngine>()`, and `state() != 0` if c == 0, since the
+    // standard engine replaces the seed 0 with 1.
+    template <typename StdEngine>
+    [[nodiscard]] auto to_std() const noexcept -> StdEngine
+        requires detail::std_lcg_of<StdEngine, UIntType>
+    {
+        assert(affine_ == affine_type::template from_std<StdEngine>());
+        return StdEngine { state_ };
+    }
+
+    // Converts `engines[i]` to `out[i]`, as `to_std` does each.
+    // Require: `engines.size() == out.size()`, and the requirements of `to_std` for each engine.
+    template <typename StdEngine>
+    static auto to_std(std::span<const LCGEngine> engines, std::span<StdEngine> out) noexcept -> void
+        requires detail::std_lcg_of<StdEngine, UIntType>
+    {
+        assert(engines.size() == out.size());
+        for (std::size_t i { 0 }; i != engines.size(); ++i) {
+            out[i] = engines[i].template to_std<StdEngine>();
+        }
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        detail::instrument_count(&detail::InstrumentCounters::engine_steps);
+        state_ = affine_(state_);
+        return state_;
+    }
+
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
+    {
+        instrument_jump(steps, false, false);
+        return affine_.powered(steps)(state_);
+    }
+
+    // Fills `out` with the next `out.size()` values of `operator()`, and advances the engine past them.
+    // The values are produced by `generation_lanes` independent chains, each stepped by f^generation_lanes,
+    // instead of one chain where every step waits for the previous one.
+    constexpr auto generate(std::span<result_type> out) noexcept -> void
+    {
+        constexpr std::size_t lanes { generation_lanes };
+        if (out.size() < 2 * lanes) {
+            std::ranges::generate(out, std::ref(*this));
+            return;
+        }
+
+        std::ranges::generate(out.first(lanes), std::ref(*this));
+        detail::instrument_count(&detail::InstrumentCounters::engine_steps, out.size() - lanes);
+        // out[i] == stride(out[i - lanes]).
+        affine_.powered(lanes).apply_each(out.first(out.size() - lanes), out.subspan(lanes));
+        state_ = out.back();
+    }
+
+    // Same as `operator()` called `n` times, writing the results to `out`, but generated in blocks with `generate`.
+    template <std::output_iterator<const UIntType&> OutputIt>
+    constexpr auto generate_n(OutputIt out, std::size_t n) -> OutputIt
+    {
+        if constexpr (detail::contiguous_iterator_of<OutputIt, result_type>) {
+            this->generate(std::span<result_type> { std::to_address(out), n });
+            return out + static_cast<std::iter_difference_t<OutputIt>>(n);
+        } else {
+            constexpr std::size_t block_size { 16 * generation_lanes };
+            std::array<result_type, block_size> block {};
+            while (n != 0) {
+                const std::size_t count { std::min(block_size, n) };
+                this->generate(std::span { block }.first(count));
+                out = std::ranges::copy_n(block.begin(), static_cast<std::ptrdiff_t>(count), std::move(out)).out;
+                n -= count;
+            }
+            return out;
+        }
+    }
+
+    // Returns the state `steps` calls of `operator()` ago, i.e. x such that `value_after_n_steps` from x gives `state()`.
+    // Each call computes the inverse modulo m: for many backward jumps, pass an `LCGJumpTable`, which keeps it.
+    // Require: gcd(a, m) == 1, so that the transform is invertible.
+    // Time complexity: O(log(m) + log(n)).
+    [[nodiscard]] constexpr auto value_before_n_steps(unsigned long long steps) const noexcept -> result_type
+    {
+        instrument_jump(steps, true, false);
+        const std::optional<affine_type> inverse { affine_.inverse() };
+        assert(inverse.has_value());
+        return inverse->powered(steps)(state_);
+    }
+
+    // Same as `value_before_n_steps(unsigned long long)`, or `std::nullopt` if gcd(a, m) != 1, for parameters not
+    // known to be invertible, e.g. read at run time.
+    // Time complexity: O(log(m) + log(n)).
+    [[nodiscard]] constexpr auto try_value_before_n_steps(unsigned long long steps) const noexcept -> std::optional<result_type>
+    {
+        const std::optional<affine_type> inverse { affine_.inverse() };
+        if (!inverse.has_value()) {
+            return std::nullopt;
+        }
+        instrument_jump(steps, true, false);
+        return inverse->powered(steps)(state_);
+    }
+
+    constexpr auto discard(unsigned long long n) noexcept -> void
+    {
+        state_ = this->value_after_n_steps(n);
+    }
+
+    // Same as `value_after_n_steps(unsigned long long)`, for counts wider than 64 bits.
+    template <detail::wide_unsigned_integer_like N>
+    [[nodiscard]] constexpr auto value_after_n_steps(const N& steps) const noexcept -> result_type
+    {
+        instrument_jump(steps, false, false);
+        return affine_.powered(steps)(state_);
+    }
+
+    // Same as `value_before_n_steps(unsigned long long)`, for counts wider than 64 bits.
+    // Require: gcd(a, m) == 1.
+    template <detail::wide_unsigned_integer_like N>
+    [[nodiscard]] constexpr auto value_before_n_steps(const N& steps) const noexcept -> result_type
+    {
+        instrument_jump(steps, true, false);
+        const std::optional<affine_type> inverse { affine_.inverse() };
+        assert(inverse.has_value());
+        return inverse->powered(steps)(state_);
+    }
+
+    // Same as `discard(unsigned long long)`, for counts wider than 64 bits, e.g. jumping most of the way around
+    // a period of 2^128.
+    template <detail::wide_unsigned_integer_like N>
+    constexpr auto discard(const N& n) noexcept -> void
+    {
+        state_ = this->value_after_n_steps(n);
+    }
+
+    // Moves the state forwards if `n` > 0, or backwards if `n` < 0.
+    // Require: gcd(a, m) == 1 if `n` < 0.
+    template <std::signed_integral SignedInt>
+    constexpr auto discard(SignedInt n) noexcept -> void
+    {
+        state_ = n >= 0 ? this->value_after_n_steps(static_cast<unsigned long long>(n))
+                        : this->value_before_n_steps(detail::magnitude(n));
+    }
+
+    // Require: `table` be built from `affine()`.
+    // Time complexity: O(number of nonzero digits of n).
+    template <unsigned WindowBits>
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps, const LCGJumpTable<UIntType, WindowBits>& table) const noexcept -> result_type
+    {
+        assert(table.affine() == affine_);
+        instrument_jump(steps, false, true);
+        return table.advance(state_, steps);
+    }
+
+    // Require: `table` be built from `affine()`.
+    // Time complexity: O(number of nonzero digits of n).
+    template <unsigned WindowBits>
+    constexpr auto discard(unsigned long long n, const LCGJumpTable<UIntType, WindowBits>& table) noexcept -> void
+    {
+        state_ = this->value_after_n_steps(n, table);
     }
-    return result;
-}
 
-// When m == 0, the modulus mathematically equals (numeric_limits<T>::max() + 1).
-template <std::unsigned_integral T>
-struct UnsignedModder {
-private:
-    using UnsignedBigger = least_doubled_uint_t<T>;
-    using SignedBigger = least_doubled_int_t<T>;
+    // Require: `inverse_table` be built from `*affine().inverse()`, e.g. by `table.inverse_table()`.
+    // Time complexity: O(number of nonzero digits of n).
+    template <unsigned WindowBits>
+    [[nodiscard]] constexpr auto value_before_n_steps(unsigned long long steps, const LCGJumpTable<UIntType, WindowBits>& inverse_table) const noexcept -> result_type
+    {
+        assert(compose(affine_, inverse_table.affine()) == affine_.identity());
+        instrument_jump(steps, true, true);
+        return inverse_table.advance(state_, steps);
+    }
 
-    [[nodiscard]] constexpr auto internal_sum(T x) const noexcept -> UnsignedBigger
+    // Moves the state forwards through `table` if `n` >= 0, or backwards by the powers of `table.inverse()`, which
+    // the table computed once, otherwise.
+    // Require: `table` be built from `affine()`, and gcd(a, m) == 1 if `n` < 0.
+    // Time complexity: O(number of nonzero digits of n) if `n` >= 0, O(log(|n|)) otherwise.
+    template <std::signed_integral SignedInt, unsigned WindowBits>
+    constexpr auto discard(SignedInt n, const LCGJumpTable<UIntType, WindowBits>& table) noexcept -> void
     {
-        return static_cast<UnsignedBigger>(x);
+        if (n >= 0) {
+            state_ = this->value_after_n_steps(static_cast<unsigned long long>(n), table);
+            return;
+        }
+        assert(table.affine() == affine_ && table.inverse().has_value());
+        instrument_jump(detail::magnitude(n), true, false);
+        state_ = table.inverse()->powered(detail::magnitude(n))(state_);
     }
 
-    template <typename... Tail>
-    [[nodiscard]] constexpr auto internal_sum(T x, Tail... tail) const noexcept -> UnsignedBigger
+    // Require: `table` be built from `affine()`, and `inverse_table` from `*affine().inverse()`.
+    // Only `table` is used if `n` >= 0, and only `inverse_table` otherwise.
+    // Time complexity: O(number of nonzero digits of |n|).
+    template <std::signed_integral SignedInt, unsigned WindowBits>
+    constexpr auto discard(SignedInt n, const LCGJumpTable<UIntType, WindowBits>& table, const LCGJumpTable<UIntType, WindowBits>& inverse_table) noexcept -> void
     {
-        return static_cast<UnsignedBigger>(x) + internal_sum(tail...);
+        state_ = n >= 0 ? this->value_after_n_steps(static_cast<unsigned long long>(n), table)
+                        : this->value_before_n_steps(detail::magnitude(n), inverse_table);
     }
 
-    [[nodiscard]] constexpr auto internal_prod_mod(T x) const noexcept -> UnsignedBigger
+    // Writes `value_after_n_steps(indices[k])` to out[k] for every k.
+    // Each index not below the previous one is reached from the previous value by jumping the difference with
+    // `table`; any other index is reached from `state()`. So sorted indices cost one composition per nonzero digit
+    // of each difference, instead of a `powered` each. Unsorted indices are not sorted first: sorting costs more than
+    // a jump through the table from `state()`.
+    // `indices` may hold any built-in unsigned type up to 64 bits, e.g. `std::vector<std::uint64_t>`.
+    // Require: `indices.size() == out.size()`, and `table` be built from `affine()`.
+    // Time complexity: O(number of nonzero digits of the differences and restarted indices).
+    template <detail::step_count_range Indices, unsigned WindowBits>
+    constexpr auto values_at(const Indices& indices, std::span<result_type> out, const LCGJumpTable<UIntType, WindowBits>& table) const noexcept -> void
     {
-        return (*this)(static_cast<UnsignedBigger>(x));
+        const std::span<const std::ranges::range_value_t<Indices>> index_view { indices };
+        assert(index_view.size() == out.size());
+        assert(table.affine() == affine_);
+        result_type value { state_ };
+        unsigned long long steps { 0 };
+        for (std::size_t k { 0 }; k != index_view.size(); ++k) {
+            if (index_view[k] < steps) {
+                value = state_;
+                steps = 0;
+            }
+            instrument_jump(index_view[k] - steps, false, true);
+            value = table.advance(value, index_view[k] - steps);
+            steps = index_view[k];
+            out[k] = value;
+        }
     }
 
-    template <typename... Tail>
-    [[nodiscard]] constexpr auto internal_prod_mod(T x, Tail... tail) const noexcept -> UnsignedBigger
+    // Same as the above, with a radix-16 `LCGJumpTable` built for the call, or with a `powered` per index for fewer
+    // than `values_at_min_table_size` indices. For many batches, build the table once.
+    template <detail::step_count_range Indices>
+    constexpr auto values_at(const Indices& indices, std::span<result_type> out) const noexcept -> void
     {
-        return (*this)(static_cast<UnsignedBigger>(x) * internal_prod_mod(tail...));
+        const std::span<const std::ranges::range_value_t<Indices>> index_view { indices };
+        assert(index_view.size() == out.size());
+        if (index_view.size() < values_at_min_table_size) {
+            for (std::size_t k { 0 }; k != index_view.size(); ++k) {
+                out[k] = this->value_after_n_steps(static_cast<unsigned long long>(index_view[k]));
+            }
+            return;
+        }
+        this->values_at(index_view, out, LCGJumpTable<UIntType, 4> { affine_ });
     }
 
-public:
-    T m;
+    // Returns the sum of the next `n` values of `operator()`, modulo m (modulo 2^digits when m == 0).
+    // Time complexity: O(log(n)).
+    [[nodiscard]] constexpr auto sum_of_next(unsigned long long n) const noexcept -> result_type
+    {
+        return LCGAffineSums<UIntType> { affine_ }.powered(n).sum(state_);
+    }
 
-    template <typename Bigger>
-    [[nodiscard]] constexpr auto real_m() const noexcept -> Bigger
-        requires integer_like<Bigger> && (sizeof(Bigger) > sizeof(T))
+    // Returns the sum of the squares of the next `n` values of `operator()`, modulo m (modulo 2^digits when m == 0).
+    // Time complexity: O(log(n)).
+    [[nodiscard]] constexpr auto sum_of_squares_of_next(unsigned long long n) const noexcept -> result_type
     {
-        return m != 0 ? m : static_cast<Bigger>(std::numeric_limits<T>::max()) + 1;
+        return LCGAffineSums<UIntType, 2> { affine_ }.powered(n).sum_of_squares(state_);
     }
 
-    template <typename U>
-    [[nodiscard]] constexpr auto operator()(U x) const noexcept -> T
-        requires unsigned_integer_like<std::remove_cvref_t<U>> && (sizeof(std::remove_cvref_t<U>) <= sizeof(UnsignedBigger))
+    // Returns the least n such that n calls of `operator()` from the state `from` reach the state `to`,
+    // or `std::nullopt` if `to` is never reached.
+    // Require: m is 0, a power of two, or a prime.
+    [[nodiscard]] constexpr auto steps_between(result_type from, result_type to) const -> std::optional<unsigned long long>
+        requires std::unsigned_integral<UIntType>
     {
-        const auto real_m { this->real_m<UnsignedBigger>() };
-        return static_cast<T>(x % real_m);
+        return affine_.steps_between(from, to);
     }
 
-    template <typename U>
-    [[nodiscard]] constexpr auto operator()(U x) const noexcept -> T
-        requires signed_integer_like<std::remove_cvref_t<U>> && (sizeof(std::remove_cvref_t<U>) <= sizeof(SignedBigger))
+    // Same result as `affine().period()`.
+    [[nodiscard]] constexpr auto period() const -> detail::least_doubled_uint_t<UIntType>
+        requires std::unsigned_integral<UIntType>
     {
-        const auto real_m { this->real_m<SignedBigger>() };
-        const SignedBigger result { static_cast<SignedBigger>(x) % real_m };
-        return static_cast<T>(result < 0 ? result + real_m : result);
+        return affine_.period();
     }
 
-    [[nodiscard]] constexpr auto mod(T x) const noexcept -> T
+    // Returns the length of the cycle that the values of `operator()` from the current state enter.
+    [[nodiscard]] constexpr auto cycle_length() const -> detail::least_doubled_uint_t<UIntType>
+        requires std::unsigned_integral<UIntType>
     {
-        return (*this)(x);
+        return affine_.cycle_length(state_);
     }
 
-    template <typename... Args>
-    [[nodiscard]] constexpr auto plus_mod(Args... args) const noexcept -> T
+    // Same result as `cycle_length()`, without factorizing m again.
+    // Require: `structure.affine() == affine()`.
+    [[nodiscard]] constexpr auto cycle_length(const LCGCycleStructure<UIntType>& structure) const -> detail::least_doubled_uint_t<UIntType>
+        requires std::unsigned_integral<UIntType>
     {
-        return (*this)(internal_sum(args...));
+        assert(structure.affine() == affine_);
+        return structure.cycle_length(state_);
     }
 
-    [[nodiscard]] constexpr auto minus_mod(T x, T y) const noexcept -> T
+    // Returns the substream of worker `i` of `k`, when the next `k * block_len` values are dealt out in blocks:
+    // worker `i` gets values `i * block_len` to `(i + 1) * block_len - 1` (counting the next value as 0).
+    // The substream continues past its block; the caller takes `block_len` values from it.
+    // Require: `i < k`.
+    // Time complexity: O(log(i * block_len)).
+    [[nodiscard]] constexpr auto split_block(unsigned long long k, unsigned long long i, unsigned long long block_len) const noexcept -> LCGSubstream<UIntType>
     {
-        return (*this)(static_cast<UnsignedBigger>(x) - y);
+        assert(i < k);
+        assert(block_len == 0 || i <= (std::numeric_limits<unsigned long long>::max() - 1) / block_len);
+        return LCGSubstream<UIntType> { affine_, this->value_after_n_steps((i * block_len) + 1) };
     }
 
-    template <typename... Args>
-    [[nodiscard]] constexpr auto times_mod(Args... args) const noexcept -> T
+    // Returns the substream of worker `i` of `k`, when the values are dealt out in turn:
+    // worker `i` gets values `i`, `i + k`, `i + 2k`, ... (counting the next value as 0).
+    // Require: `i < k`.
+    // Time complexity: O(log(k)).
+    [[nodiscard]] constexpr auto split_leapfrog(unsigned long long k, unsigned long long i) const noexcept -> LCGSubstream<UIntType>
     {
-        return internal_prod_mod(args...);
+        assert(i < k);
+        return LCGSubstream<UIntType> { affine_.powered(k), this->value_after_n_steps(i + 1) };
     }
 
-    [[nodiscard]] constexpr auto times_plus_mod(T x, T y, T z) const noexcept -> T
+    // Returns the values of the calls of `operator()` numbered [first, last), counting the next call as 0, as a view
+    // computing them on demand. The view copies the engine, so later calls on the engine do not change it.
+    // Require: first <= last.
+    // Time complexity: O(1).
+    [[nodiscard]] constexpr auto sequence(unsigned long long first, unsigned long long last) const noexcept -> LCGSequenceView<UIntType>
     {
-        return (*this)((static_cast<UnsignedBigger>(x) * y) + z);
+        return LCGSequenceView<UIntType> { affine_, state_, first, last };
     }
 
-    [[nodiscard]] constexpr auto times_plus_plus_mod(T x, T y, T z, T w) const noexcept -> T
+    // Same as `sequence(0, count)`.
+    [[nodiscard]] constexpr auto sequence(unsigned long long count) const noexcept -> LCGSequenceView<UIntType>
     {
-        return (*this)((static_cast<UnsignedBigger>(x) * y) + z + w);
+        return this->sequence(0, count);
     }
 
-    [[nodiscard]] constexpr auto pow_mod(T base, unsigned long long expo) const noexcept -> T
+    [[nodiscard]] constexpr auto a() const noexcept -> UIntType { return affine_.a(); }
+    [[nodiscard]] constexpr auto c() const noexcept -> UIntType { return affine_.c(); }
+    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return affine_.m(); }
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+    [[nodiscard]] constexpr auto state() const noexcept -> result_type { return state_; }
+    constexpr auto set_a(UIntType new_a) noexcept -> void { affine_.set_a(new_a); }
+    constexpr auto set_c(UIntType new_c) noexcept -> void { affine_.set_c(new_c); }
+    constexpr auto set_m(UIntType new_m) noexcept -> void { affine_.set_m(new_m); }
+    constexpr auto set_affine(const affine_type& new_affine) noexcept -> void { affine_ = new_affine; }
+    constexpr auto set_state(result_type new_seed) noexcept -> void { state_ = this->modder()(new_seed); }
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGEngine& lhs, const LCGEngine& rhs) noexcept -> bool = default;
+};
+
+// LCG whose parameters are template arguments, like `std::linear_congruential_engine`.
+// The modulus is a compile-time constant, so stepping needs no division by a variable,
+// and jumps go through a radix-16 `LCGJumpTable` computed at compile time: a jump applies one stored power per
+// nonzero hexadecimal digit of the distance, at most 16, and composes nothing at run time.
+// The table is only computed for the instantiations whose jumps are used.
+template <std::unsigned_integral UIntType, UIntType A, UIntType C, UIntType M>
+class StaticLCGEngine {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    using dynamic_type = LCGEngine<UIntType>;
+    using jump_table_type = LCGJumpTable<UIntType, 4>;
+    using std_type = std::linear_congruential_engine<UIntType, A, C, M>;
+    using period_type = typename LCGCycleStructure<UIntType>::period_type;
+
+private:
+    using modder_type = detail::StaticModder<UIntType, M>;
+
+    static constexpr affine_type affine_ { A, C, M };
+    static constexpr jump_table_type jump_table_ { affine_ };
+    // Only computed for the instantiations that jump backwards, so the forward jumps need no gcd(a, m) == 1.
+    static constexpr jump_table_type inverse_jump_table_ { *affine_.inverse() };
+    // Like the jump tables, only computed for the instantiations whose period is used.
+    static constexpr period_type period_ { affine_.period() };
+
+    result_type state_;
+
+    // Same result as `table.advance(x, steps)`, reducing by the constant modulus.
+    [[nodiscard]] static constexpr auto advance(const jump_table_type& table, result_type x, unsigned long long steps) noexcept -> result_type
     {
-        const auto mul_mod {
-            [*this](T x, T y) noexcept -> T {
-                return this->times_mod(x, y);
+        constexpr unsigned long long digit_mask { (1ULL << jump_table_type::window_bits) - 1 };
+        for (std::size_t i { 0 }; steps != 0; ++i, steps >>= jump_table_type::window_bits) {
+            if (const unsigned long long digit { steps & digit_mask }; digit != 0) {
+                const affine_type& power { table.power(i, digit) };
+                x = modder_type::times_plus_mod(power.a(), x, power.c());
             }
-        };
-        return double_and_add(base, expo, mul_mod, (*this)(1));
+        }
+        return x;
     }
 
-    [[nodiscard]] constexpr friend auto operator==(UnsignedModder lhs, UnsignedModder rhs) noexcept -> bool = default;
-};
+public:
+    static constexpr UIntType default_seed { 1U };
 
-template <typename>
-struct std_lcg_traits;
+    constexpr StaticLCGEngine() noexcept
+        : StaticLCGEngine { default_seed }
+    {
+    }
 
-template <std::unsigned_integral UIntType, UIntType ax, UIntType cx, UIntType mx>
-struct std_lcg_traits<std::linear_congruential_engine<UIntType, ax, cx, mx>> {
-    using result_type = UIntType;
-    static constexpr UIntType a { ax };
-    static constexpr UIntType c { cx };
-    static constexpr UIntType m { mx };
-};
+    explicit constexpr StaticLCGEngine(result_type state) noexcept
+        : state_ { modder_type::mod(state) }
+    {
+    }
 
-template <typename T, typename UIntType>
-concept std_lcg_of = std::same_as<UIntType, typename std_lcg_traits<T>::result_type>;
+    // Operations on `std::linear_congruential_engine` are not `constexpr`.
+    // So the factory function is not `constexpr`.
+    [[nodiscard]] static auto from_std(const std_type& engine) noexcept(false) -> StaticLCGEngine
+    {
+        return StaticLCGEngine { detail::extract_state(engine) };
+    }
 
-template <std::unsigned_integral UIntType, UIntType a, UIntType c, UIntType m>
-[[nodiscard]] auto extract_state(const std::linear_congruential_engine<UIntType, a, c, m>& engine) noexcept(false) -> UIntType
-{
-    std::ostringstream oss {};
-    oss << engine;
-    std::istringstream iss { oss.str() };
-    UIntType state {};
-    iss >> state;
-    return state;
-}
+    // Converts `engines[i]` to `out[i]`, as `from_std` does each.
+    // Require: `engines.size() == out.size()`.
+    static auto from_std(std::span<const std_type> engines, std::span<StaticLCGEngine> out) noexcept(false) -> void
+    {
+        assert(engines.size() == out.size());
+        for (std::size_t i { 0 }; i != engines.size(); ++i) {
+            out[i] = from_std(engines[i]);
+        }
+    }
 
-} // namespace ls_hower::lcg_predict::detail
+    // The standard engine whose next output is the next output of `*this`.
+    // Require: `state() != 0` if C == 0, since the standard engine replaces the seed 0 with 1.
+    [[nodiscard]] auto to_std() const noexcept -> std_type
+    {
+        return std_type { state_ };
+    }
 
-namespace ls_hower::lcg_predict {
+    // Converts `engines[i]` to `out[i]`, as `to_std` does each.
+    // Require: `engines.size() == out.size()`, and the requirement of `to_std` for each engine.
+    static auto to_std(std::span<const StaticLCGEngine> engines, std::span<std_type> out) noexcept -> void
+    {
+        assert(engines.size() == out.size());
+        for (std::size_t i { 0 }; i != engines.size(); ++i) {
+            out[i] = engines[i].to_std();
+        }
+    }
 
-template <std::unsigned_integral UIntType>
-class LCGAffineTransform {
-    detail::UnsignedModder<UIntType> modder_;
-    UIntType a_;
-    UIntType c_;
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        state_ = modder_type::times_plus_mod(affine_.a(), state_, affine_.c());
+        return state_;
+    }
 
-public:
-    using result_type = UIntType;
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
+    {
+        return advance(jump_table_, state_, steps);
+    }
 
-    explicit constexpr LCGAffineTransform(UIntType a, UIntType c, UIntType m = 0) noexcept // NOLINT : order of triplet (a, c, m) is conventional, not easily swappable.
-        : modder_ { m }
-        , a_ { modder_(a) }
-        , c_ { modder_(c) }
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    constexpr auto discard(unsigned long long n) noexcept -> void
     {
+        state_ = this->value_after_n_steps(n);
     }
 
-    template <typename StdEngine>
-    [[nodiscard]] static constexpr auto from_std() noexcept -> LCGAffineTransform
-        requires detail::std_lcg_of<std::remove_cvref_t<StdEngine>, UIntType>
+    // Require: gcd(a, m) == 1.
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    [[nodiscard]] constexpr auto value_before_n_steps(unsigned long long steps) const noexcept -> result_type
     {
-        using traits = detail::std_lcg_traits<std::remove_cvref_t<StdEngine>>;
-        return LCGAffineTransform { traits::a, traits::c, traits::m };
+        return advance(inverse_jump_table_, state_, steps);
     }
 
-    constexpr auto set_a(UIntType a) noexcept -> void { a_ = modder_(a); }
-    constexpr auto set_c(UIntType c) noexcept -> void { c_ = modder_(c); }
-    constexpr auto set_m(UIntType m) noexcept -> void { modder_.m = m; }
-    [[nodiscard]] constexpr auto a() const noexcept -> UIntType { return a_; }
-    [[nodiscard]] constexpr auto c() const noexcept -> UIntType { return c_; }
-    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return modder_.m; }
+    // Same as `LCGEngine::steps_between`.
+    [[nodiscard]] static constexpr auto steps_between(result_type from, result_type to) -> std::optional<unsigned long long>
+    {
+        return affine_.steps_between(from, to);
+    }
 
-    [[nodiscard]] constexpr auto operator()(result_type x) const noexcept -> result_type
+    // Same result as `affine().period()`, computed at compile time.
+    [[nodiscard]] static constexpr auto period() noexcept -> period_type { return period_; }
+
+    // Same as `LCGEngine::cycle_length()`.
+    [[nodiscard]] constexpr auto cycle_length() const -> period_type
     {
-        return modder_.times_plus_mod(a_, x, c_);
+        return affine_.cycle_length(state_);
     }
 
-    constexpr auto operator+=(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    // Require: gcd(a, m) == 1 if `n` < 0.
+    // Time complexity: O(number of nonzero hexadecimal digits of |n|).
+    template <std::signed_integral SignedInt>
+    constexpr auto discard(SignedInt n) noexcept -> void
     {
-        assert(modder_ == rhs.modder_);
-        a_ = modder_.plus_mod(a_, rhs.a_);
-        c_ = modder_.plus_mod(c_, rhs.c_);
-        return *this;
+        state_ = n >= 0 ? this->value_after_n_steps(static_cast<unsigned long long>(n))
+                        : this->value_before_n_steps(detail::magnitude(n));
     }
 
-    [[nodiscard]] friend constexpr auto operator+(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+    // The compile-time table of the jumps. Its entries `power(i, 1 << b)` are f^(2^(4i + b)).
+    [[nodiscard]] static constexpr auto jump_table() noexcept -> const jump_table_type& { return jump_table_; }
+    // The compile-time table of the backward jumps, built from `*affine().inverse()`.
+    // Require: gcd(a, m) == 1.
+    [[nodiscard]] static constexpr auto inverse_jump_table() noexcept -> const jump_table_type& { return inverse_jump_table_; }
+    [[nodiscard]] static constexpr auto a() noexcept -> UIntType { return affine_.a(); }
+    [[nodiscard]] static constexpr auto c() noexcept -> UIntType { return affine_.c(); }
+    [[nodiscard]] static constexpr auto m() noexcept -> UIntType { return affine_.m(); }
+    [[nodiscard]] static constexpr auto affine() noexcept -> affine_type { return affine_; }
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return affine_.min(); }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type { return affine_.max(); }
+    [[nodiscard]] constexpr auto state() const noexcept -> result_type { return state_; }
+    constexpr auto set_state(result_type new_seed) noexcept -> void { state_ = modder_type::mod(new_seed); }
+
+    [[nodiscard]] constexpr auto to_dynamic() const noexcept -> dynamic_type
     {
-        lhs += rhs;
-        return lhs;
+        return dynamic_type { affine_, state_ };
     }
 
-    constexpr auto operator-=(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    [[nodiscard]] friend constexpr auto operator==(const StaticLCGEngine& lhs, const StaticLCGEngine& rhs) noexcept -> bool = default;
+};
+
+// An `LCGEngine` with the parameters of `StaticLCGEngine<UIntType, A, C, M>`, whose jumps go through the compile-time
+// tables of that class as long as `affine()` is still A, C, M: a jump applies one stored power per nonzero
+// hexadecimal digit of the distance, and composes nothing at run time. Like those of `StaticLCGEngine`, the tables
+// are only computed for the instantiations whose jumps are used. Everything else is that of `LCGEngine`, which it
+// converts to, and whose own jumps, e.g. through an `LCGEngine` reference, compose O(log(n)) transforms.
+template <std::unsigned_integral UIntType, UIntType A, UIntType C, UIntType M>
+class PresetLCGEngine : public LCGEngine<UIntType> {
+public:
+    using result_type = UIntType;
+    using dynamic_type = LCGEngine<UIntType>;
+    using static_type = StaticLCGEngine<UIntType, A, C, M>;
+
+private:
+    // Whether the parameters still match the tables, as `set_affine` and the like may change them.
+    [[nodiscard]] constexpr auto is_preset() const noexcept -> bool
     {
-        assert(modder_ == rhs.modder_);
-        a_ = modder_.minus_mod(a_, rhs.a_);
-        c_ = modder_.minus_mod(c_, rhs.c_);
-        return *this;
+        return this->affine() == static_type::affine();
     }
 
-    [[nodiscard]] friend constexpr auto operator-(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+public:
+    constexpr PresetLCGEngine() noexcept
+        : PresetLCGEngine { dynamic_type::default_seed }
     {
-        lhs -= rhs;
-        return lhs;
     }
 
-    constexpr auto compose_assign(const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform&
+    explicit constexpr PresetLCGEngine(result_type state) noexcept
+        : dynamic_type { static_type::affine(), state }
     {
-        assert(modder_ == rhs.modder_);
-        const UIntType new_a { modder_.times_mod(a_, rhs.a_) };
-        const UIntType new_c { modder_.times_plus_mod(a_, rhs.c_, c_) };
-        a_ = new_a;
-        c_ = new_c;
-        return *this;
     }
 
-    // Returns f such that f(x) = lhs(rhs(x)).
-    [[nodiscard]] friend constexpr auto compose(LCGAffineTransform lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform
+    using dynamic_type::discard;
+    using dynamic_type::value_after_n_steps;
+    using dynamic_type::value_before_n_steps;
+    using dynamic_type::values_at;
+
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
     {
-        lhs.compose_assign(rhs);
-        return lhs;
+        if (!this->is_preset()) {
+            return dynamic_type::value_after_n_steps(steps);
+        }
+        dynamic_type::instrument_jump(steps, false, true);
+        return static_type { this->state() }.value_after_n_steps(steps);
     }
 
-    [[nodiscard]] constexpr auto identity() const noexcept -> LCGAffineTransform
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    constexpr auto discard(unsigned long long n) noexcept -> void
     {
-        return LCGAffineTransform { 1, 0, modder_.m };
+        this->set_state(this->value_after_n_steps(n));
     }
 
-    [[nodiscard]] constexpr auto powered(unsigned long long n) const noexcept -> LCGAffineTransform
+    // Require: gcd(a, m) == 1.
+    // Time complexity: O(number of nonzero hexadecimal digits of n).
+    [[nodiscard]] constexpr auto value_before_n_steps(unsigned long long steps) const noexcept -> result_type
     {
-        // Use ADL to find the hidden friend `compose`.
-        const auto composer {
-            [](const LCGAffineTransform& lhs, const LCGAffineTransform& rhs) noexcept -> LCGAffineTransform {
-                return compose(lhs, rhs);
-            }
-        };
-        return detail::double_and_add(*this, n, composer, this->identity());
+        if (!this->is_preset()) {
+            return dynamic_type::value_before_n_steps(steps);
+        }
+        dynamic_type::instrument_jump(steps, true, true);
+        return static_type { this->state() }.value_before_n_steps(steps);
     }
 
-    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return c_ == 0U ? 1U : 0U; }
-    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return modder_.m - 1U; }
-    [[nodiscard]] friend constexpr auto operator==(const LCGAffineTransform& lhs, const LCGAffineTransform& rhs) noexcept -> bool = default;
+    // Require: gcd(a, m) == 1 if `n` < 0.
+    // Time complexity: O(number of nonzero hexadecimal digits of |n|).
+    template <std::signed_integral SignedInt>
+    constexpr auto discard(SignedInt n) noexcept -> void
+    {
+        this->set_state(n >= 0 ? this->value_after_n_steps(static_cast<unsigned long long>(n))
+                               : this->value_before_n_steps(detail::magnitude(n)));
+    }
+
+    // Same as `LCGEngine::values_at` through the compile-time table, for any number of indices.
+    template <detail::step_count_range Indices>
+    constexpr auto values_at(const Indices& indices, std::span<result_type> out) const noexcept -> void
+    {
+        if (!this->is_preset()) {
+            dynamic_type::values_at(indices, out);
+            return;
+        }
+        this->values_at(indices, out, static_type::jump_table());
+    }
+
+    [[nodiscard]] constexpr auto to_dynamic() const noexcept -> dynamic_type
+    {
+        return dynamic_type { *this };
+    }
 };
 
+// What a generator built on an LCG returns from its state: `bits` bits starting at bit `shift`.
+// For example, MSVC `rand()` returns (state >> 16) & 0x7fff.
 template <std::unsigned_integral UIntType>
-class LCGEngine {
+class LCGProjection {
 public:
     using result_type = UIntType;
-    using affine_type = LCGAffineTransform<UIntType>;
 
 private:
-    affine_type affine_;
-    result_type state_;
+    unsigned shift_;
+    unsigned bits_;
 
-    [[nodiscard]] constexpr auto modder() const noexcept -> detail::UnsignedModder<UIntType>
+public:
+    // Require: 0 < bits, shift + bits <= the number of bits of `UIntType`.
+    explicit constexpr LCGProjection(unsigned shift, unsigned bits) noexcept
+        : shift_ { shift }
+        , bits_ { bits }
     {
-        return detail::UnsignedModder<UIntType> { affine_.m() };
+        assert(bits_ > 0 && shift_ + bits_ <= static_cast<unsigned>(std::numeric_limits<UIntType>::digits));
     }
 
-public:
-    static constexpr UIntType default_seed { 1U };
+    // Keeps the whole state.
+    [[nodiscard]] static constexpr auto identity() noexcept -> LCGProjection
+    {
+        return LCGProjection { 0, std::numeric_limits<UIntType>::digits };
+    }
 
-    explicit constexpr LCGEngine(affine_type affine, result_type state = default_seed) noexcept
-        : affine_ { affine }
-        , state_ { this->modder()(state) }
+    [[nodiscard]] constexpr auto shift() const noexcept -> unsigned { return shift_; }
+    [[nodiscard]] constexpr auto bits() const noexcept -> unsigned { return bits_; }
+    [[nodiscard]] constexpr auto mask() const noexcept -> result_type
     {
+        return static_cast<result_type>(std::numeric_limits<UIntType>::max() >> (std::numeric_limits<UIntType>::digits - bits_));
     }
 
-    explicit constexpr LCGEngine(UIntType a, UIntType c, UIntType m = 0, result_type state = default_seed) noexcept
-        : LCGEngine { affine_type { a, c, m }, state }
+    [[nodiscard]] constexpr auto operator()(result_type state) const noexcept -> result_type
     {
+        return static_cast<result_type>((state >> shift_) & this->mask());
     }
 
-    // Operations on `std::linear_congruential_engine` are not `constexpr`.
-    // So the factory function is not `constexpr`.
-    template <typename StdEngine>
-    [[nodiscard]] static auto from_std(StdEngine engine) noexcept(false) -> LCGEngine
-        requires detail::std_lcg_of<std::remove_cvref_t<StdEngine>, UIntType>
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return 0U; }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return this->mask(); }
+    [[nodiscard]] friend constexpr auto operator==(const LCGProjection& lhs, const LCGProjection& rhs) noexcept -> bool = default;
+};
+
+// An `LCGEngine` whose `operator()` returns the projected state, like the `rand()` of a C library.
+template <std::unsigned_integral UIntType>
+class ProjectedLCGEngine {
+public:
+    using result_type = UIntType;
+    using engine_type = LCGEngine<UIntType>;
+    using projection_type = LCGProjection<UIntType>;
+
+private:
+    engine_type engine_;
+    projection_type projection_;
+
+public:
+    explicit constexpr ProjectedLCGEngine(engine_type engine, projection_type projection) noexcept
+        : engine_ { engine }
+        , projection_ { projection }
     {
-        return LCGEngine {
-            affine_type::template from_std<std::remove_cvref_t<StdEngine>>(),
-            extract_state(engine),
-        };
     }
 
     [[nodiscard]] constexpr auto operator()() noexcept -> result_type
     {
-        state_ = affine_(state_);
-        return state_;
+        return projection_(engine_());
     }
 
+    // Time complexity: O(log(n)).
     [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
     {
-        return affine_.powered(steps)(state_);
+        return projection_(engine_.value_after_n_steps(steps));
     }
 
+    // Time complexity: O(log(n)).
     constexpr auto discard(unsigned long long n) noexcept -> void
     {
-        state_ = this->value_after_n_steps(n);
+        engine_.discard(n);
     }
 
-    [[nodiscard]] constexpr auto a() const noexcept -> UIntType { return affine_.a(); }
-    [[nodiscard]] constexpr auto c() const noexcept -> UIntType { return affine_.c(); }
-    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return affine_.m(); }
-    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
-    [[nodiscard]] constexpr auto state() const noexcept -> result_type { return state_; }
-    constexpr auto set_a(UIntType new_a) noexcept -> void { affine_.set_a(new_a); }
-    constexpr auto set_c(UIntType new_c) noexcept -> void { affine_.set_c(new_c); }
-    constexpr auto set_m(UIntType new_m) noexcept -> void { affine_.set_m(new_m); }
-    constexpr auto set_affine(const affine_type& new_affine) noexcept -> void { affine_ = new_affine; }
-    constexpr auto set_state(result_type new_seed) noexcept -> void { state_ = this->modder()(new_seed); }
+    [[nodiscard]] constexpr auto engine() const noexcept -> const engine_type& { return engine_; }
+    [[nodiscard]] constexpr auto projection() const noexcept -> projection_type { return projection_; }
+    [[nodiscard]] constexpr auto state() const noexcept -> result_type { return engine_.state(); }
+    constexpr auto set_state(result_type new_seed) noexcept -> void { engine_.set_state(new_seed); }
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return projection_.min(); }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return projection_.max(); }
 
-    [[nodiscard]] friend constexpr auto operator==(const LCGEngine& lhs, const LCGEngine& rhs) noexcept -> bool = default;
+    [[nodiscard]] friend constexpr auto operator==(const ProjectedLCGEngine& lhs, const ProjectedLCGEngine& rhs) noexcept -> bool = default;
 };
 
+// The presets are `PresetLCGEngine`s, so their jumps go through the compile-time tables of the `*_static_engine`
+// counterparts below, which are only computed by the programs that jump with them.
+
 // LCG suggested in K&R C and C standards.
-constexpr inline LCGEngine<std::uint_fast32_t> krc_rand_engine { 1103515245, 12345, 2147483648 };
+constexpr inline PresetLCGEngine<std::uint_fast32_t, 1103515245, 12345, 2147483648> krc_rand_engine {};
 
 // C++ `std::minstd_rand`.
-constexpr inline LCGEngine<std::uint_fast32_t> minstd_rand_engine { 48271, 0, 2147483647 };
+constexpr inline PresetLCGEngine<std::uint_fast32_t, 48271, 0, 2147483647> minstd_rand_engine {};
 
 // C++ `std::minstd_rand0`.
-constexpr inline LCGEngine<std::uint_fast32_t> minstd_rand0_engine { 16807, 0, 2147483647 };
+constexpr inline PresetLCGEngine<std::uint_fast32_t, 16807, 0, 2147483647> minstd_rand0_engine {};
 
 // MSVC `std::rand`.
-constexpr inline LCGEngine<std::uint_fast32_t> msvc_rand_engine { 214013, 2531011, 2147483648 };
+constexpr inline PresetLCGEngine<std::uint_fast32_t, 214013, 2531011, 2147483648> msvc_rand_engine {};
 
 // POSIX `*rand48`.
-constexpr inline LCGEngine<std::uint_fast64_t> posix_rand48_engine { 25214903917, 11, 281474976710656 };
+constexpr inline PresetLCGEngine<std::uint_fast64_t, 25214903917, 11, 281474976710656> posix_rand48_engine {};
 
 // Musl `rand`.
-constexpr inline LCGEngine<std::uint_fast64_t> musl_rand_engine { 6364136223846793005, 1, 0 };
+constexpr inline PresetLCGEngine<std::uint_fast64_t, 6364136223846793005, 1, 0> musl_rand_engine {};
+
+// What the C library functions built on the engines above return.
+// K&R `rand()`: bits 30..16.
+constexpr inline LCGProjection<std::uint_fast32_t> krc_rand_projection { 16, 15 };
+// `std::minstd_rand` and `std::minstd_rand0` return the whole state.
+constexpr inline LCGProjection<std::uint_fast32_t> minstd_rand_projection { LCGProjection<std::uint_fast32_t>::identity() };
+constexpr inline LCGProjection<std::uint_fast32_t> minstd_rand0_projection { LCGProjection<std::uint_fast32_t>::identity() };
+// MSVC `rand()`: bits 30..16.
+constexpr inline LCGProjection<std::uint_fast32_t> msvc_rand_projection { 16, 15 };
+// POSIX `lrand48()`: bits 47..17.
+constexpr inline LCGProjection<std::uint_fast64_t> posix_lrand48_projection { 17, 31 };
+// POSIX `mrand48()`: bits 47..16, as an unsigned value.
+constexpr inline LCGProjection<std::uint_fast64_t> posix_mrand48_projection { 16, 32 };
+// Musl `rand()`: bits 63..33.
+constexpr inline LCGProjection<std::uint_fast64_t> musl_rand_projection { 33, 31 };
+
+constexpr inline ProjectedLCGEngine<std::uint_fast32_t> krc_rand_output_engine { krc_rand_engine, krc_rand_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast32_t> minstd_rand_output_engine { minstd_rand_engine, minstd_rand_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast32_t> minstd_rand0_output_engine { minstd_rand0_engine, minstd_rand0_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast32_t> msvc_rand_output_engine { msvc_rand_engine, msvc_rand_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast64_t> posix_lrand48_output_engine { posix_rand48_engine, posix_lrand48_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast64_t> posix_mrand48_output_engine { posix_rand48_engine, posix_mrand48_projection };
+constexpr inline ProjectedLCGEngine<std::uint_fast64_t> musl_rand_output_engine { musl_rand_engine, musl_rand_projection };
+
+// Compile-time counterparts of the presets above, whose jump tables those use. The tables are static members, so
+// they are only computed by the programs that jump with them.
+constexpr inline StaticLCGEngine<std::uint_fast32_t, 1103515245, 12345, 2147483648> krc_rand_static_engine {};
+constexpr inline StaticLCGEngine<std::uint_fast32_t, 48271, 0, 2147483647> minstd_rand_static_engine {};
+constexpr inline StaticLCGEngine<std::uint_fast32_t, 16807, 0, 2147483647> minstd_rand0_static_engine {};
+constexpr inline StaticLCGEngine<std::uint_fast32_t, 214013, 2531011, 2147483648> msvc_rand_static_engine {};
+constexpr inline StaticLCGEngine<std::uint_fast64_t, 25214903917, 11, 281474976710656> posix_rand48_static_engine {};
+constexpr inline StaticLCGEngine<std::uint_fast64_t, 6364136223846793005, 1, 0> musl_rand_static_engine {};
 
 } // namespace ls_hower::lcg_predict
 
+// Iterators of `LCGSequenceView` hold everything they need, so they may outlive the view.
+template <typename UIntType>
+inline constexpr bool std::ranges::enable_borrowed_range<ls_hower::lcg_predict::LCGSequenceView<UIntType>> = true;
+
 #endif // LCG_PREDICT_HPP_INCLUDED
@@ -0,0 +1,475 @@
+// 2026-10  lcg_predict_fingerprint.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_FINGERPRINT_HPP_INCLUDED
+#define LCG_PREDICT_FINGERPRINT_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+#include "lcg_predict_recovery.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ls_hower::lcg_predict {
+
+// A generator and a seed: `projection` of the states of `affine` after `seed`.
+struct FingerprintSource {
+    LCGAffineTransform<std::uint64_t> affine;
+    LCGProjection<std::uint64_t> projection;
+    std::uint64_t seed;
+
+    // The source of `engine`, seeded with its current state.
+    template <std::unsigned_integral UIntType>
+    [[nodiscard]] static constexpr auto from(const ProjectedLCGEngine<UIntType>& engine) noexcept -> FingerprintSource
+    {
+        constexpr int digits { std::numeric_limits<UIntType>::digits };
+        static_assert(digits <= 64, "an index stores states in 64 bits");
+
+        const LCGAffineTransform<UIntType> affine { engine.engine().affine() };
+        std::uint64_t m { affine.m() };
+        if constexpr (digits < 64) {
+            // m == 0 is 2^digits, which is only 0 in 64 bits.
+            m = m == 0 ? std::uint64_t { 1 } << digits : m;
+        }
+        return FingerprintSource {
+            LCGAffineTransform<std::uint64_t> { affine.a(), affine.c(), m },
+            LCGProjection<std::uint64_t> { engine.projection().shift(), engine.projection().bits() },
+            engine.state(),
+        };
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const FingerprintSource& lhs, const FingerprintSource& rhs) noexcept -> bool = default;
+};
+
+// Observed outputs start at `offset` of `source`: `offset` outputs came before them.
+struct FingerprintMatch {
+    std::size_t source;
+    unsigned long long offset;
+
+    [[nodiscard]] friend constexpr auto operator==(const FingerprintMatch& lhs, const FingerprintMatch& rhs) noexcept -> bool = default;
+};
+
+// The output presets of lcg_predict.hpp from their default seeds, named by `fingerprint_preset_names`.
+constexpr inline std::array<std::string_view, 7> fingerprint_preset_names {
+    "krc_rand", "minstd_rand", "minstd_rand0", "msvc_rand", "posix_lrand48", "posix_mrand48", "musl_rand"
+};
+constexpr inline std::array<FingerprintSource, 7> fingerprint_presets {
+    FingerprintSource::from(krc_rand_output_engine),
+    FingerprintSource::from(minstd_rand_output_engine),
+    FingerprintSource::from(minstd_rand0_output_engine),
+    FingerprintSource::from(msvc_rand_output_engine),
+    FingerprintSource::from(posix_lrand48_output_engine),
+    FingerprintSource::from(posix_mrand48_output_engine),
+    FingerprintSource::from(musl_rand_output_engine),
+};
+
+// Returns the presets from each of `seeds`: source i is preset i / seeds.size() from seeds[i % seeds.size()].
+[[nodiscard]] constexpr auto preset_fingerprint_sources(std::span<const std::uint64_t> seeds) -> std::vector<FingerprintSource>
+{
+    std::vector<FingerprintSource> result {};
+    result.reserve(fingerprint_presets.size() * seeds.size());
+    for (const FingerprintSource& preset : fingerprint_presets) {
+        for (const std::uint64_t seed : seeds) {
+            result.push_back(FingerprintSource { preset.affine, preset.projection, seed });
+        }
+    }
+    return result;
+}
+
+} // namespace ls_hower::lcg_predict
+
+namespace ls_hower::lcg_predict::detail {
+
+// An index is an array of 64-bit words, the same in memory and in a file:
+// - header: `fingerprint_magic`, `fingerprint_version`, generator count, source count, baby steps, giant steps,
+//   bucket bits, entry count;
+// - each generator (distinct affine and projection): a, c, m, shift, bits, a and c of the giant step, source count;
+// - each source: generator, seed;
+// - bucket starts: 2^(bucket bits) + 1 indices of entries;
+// - each entry, grouped by bucket: state, source << 32 | baby step.
+// "LCGFPIX1" read as a little-endian word: a file from a machine of the other byte order fails the check.
+constexpr inline std::uint64_t fingerprint_magic { 0x3158'4950'4647'434cULL };
+constexpr inline std::uint64_t fingerprint_version { 1 };
+constexpr inline std::size_t fingerprint_header_words { 8 };
+constexpr inline std::size_t fingerprint_generator_words { 8 };
+constexpr inline std::size_t fingerprint_source_words { 2 };
+constexpr inline std::size_t fingerprint_entry_words { 2 };
+
+// Multiplicative hashing: the high bits of the product depend on every bit of `state`, including the high bits of
+// states modulo 2^k, whose low bits have short periods.
+[[nodiscard]] constexpr auto fingerprint_bucket(std::uint64_t state, unsigned bucket_bits) noexcept -> std::size_t
+{
+    return static_cast<std::size_t>((state * 0x9e37'79b9'7f4a'7c15ULL) >> (64U - bucket_bits));
+}
+
+// The number of words of an index with this header, or 0 if the header is not that of an index.
+[[nodiscard]] constexpr auto fingerprint_index_words(std::span<const std::uint64_t> words) noexcept -> std::size_t
+{
+    if (words.size() < fingerprint_header_words || words[0] != fingerprint_magic || words[1] != fingerprint_version) {
+        return 0;
+    }
+    const std::uint64_t generators { words[2] };
+    const std::uint64_t sources { words[3] };
+    const std::uint64_t bucket_bits { words[6] };
+    const std::uint64_t entries { words[7] };
+    // Bounds that keep the sum below from overflowing, far beyond what fits in memory.
+    if (generators > sources || sources >= (1ULL << 32) || bucket_bits == 0 || bucket_bits > 40 || entries >= (1ULL << 56)) {
+        return 0;
+    }
+    return fingerprint_header_words + (fingerprint_generator_words * generators) + (fingerprint_source_words * sources)
+        + ((1ULL << bucket_bits) + 1) + (fingerprint_entry_words * entries);
+}
+
+// Whether the generators and sources of an index can be read without undefined behaviour: each projection
+// satisfies the requirements of `LCGProjection` and `recover_state`, and each source names a generator.
+// The buckets and entries need no check: `FingerprintIndexView::find` bounds what it reads from them.
+// Require: fingerprint_index_words(words) == words.size().
+// Time complexity: O(generator count + source count).
+[[nodiscard]] constexpr auto fingerprint_records_valid(std::span<const std::uint64_t> words) noexcept -> bool
+{
+    const std::uint64_t generators { words[2] };
+    const std::uint64_t sources { words[3] };
+    const std::span<const std::uint64_t> generator_words { words.subspan(fingerprint_header_words, fingerprint_generator_words * generators) };
+    for (std::size_t g { 0 }; g != generator_words.size(); g += fingerprint_generator_words) {
+        const std::uint64_t m { generator_words[g + 2] };
+        const std::uint64_t shift { generator_words[g + 3] };
+        const std::uint64_t bits { generator_words[g + 4] };
+        if (bits == 0 || bits > 64 || shift > 64 - bits) {
+            return false;
+        }
+        // The projection keeps every bit of the state above its shift: m <= 2^(shift + bits), with m == 0 as 2^64.
+        if (shift + bits != 64 && (m == 0 || ((m - 1) >> (shift + bits)) != 0)) {
+            return false;
+        }
+    }
+    const std::span<const std::uint64_t> source_words { words.subspan(fingerprint_header_words + generator_words.size(), fingerprint_source_words * sources) };
+    for (std::size_t i { 0 }; i != source_words.size(); i += fingerprint_source_words) {
+        if (source_words[i] >= generators) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace ls_hower::lcg_predict::detail
+
+namespace ls_hower::lcg_predict {
+
+// Returns an index of the first `baby_steps * giant_steps` outputs of each source, for `FingerprintIndexView`.
+// It stores the states after the first `baby_steps` outputs of each source, hashed into buckets, and, for each
+// distinct generator, f^(-baby_steps): the giant step.
+// Require: each source's a be invertible modulo its m, its projection keep every bit of the state above its shift
+// (as for `recover_state`), `sources.size()` < 2^32, and 0 < `baby_steps` < 2^32.
+// Time complexity: O(sources.size() * baby_steps).
+[[nodiscard]] constexpr auto build_fingerprint_index(std::span<const FingerprintSource> sources, std::uint64_t baby_steps, std::uint64_t giant_steps) -> std::vector<std::uint64_t>
+{
+    assert(sources.size() < (1ULL << 32) && baby_steps != 0 && baby_steps < (1ULL << 32));
+
+    std::vector<std::size_t> source_generators(sources.size());
+    std::vector<std::size_t> generator_sources {};
+    std::vector<std::size_t> generator_sizes {};
+    for (std::size_t i { 0 }; i != sources.size(); ++i) {
+        const auto same_generator {
+            [&sources, i](std::size_t first) noexcept -> bool {
+                return sources[first].affine == sources[i].affine && sources[first].projection == sources[i].projection;
+            }
+        };
+        const auto found { std::ranges::find_if(generator_sources, same_generator) };
+        source_generators[i] = static_cast<std::size_t>(found - generator_sources.begin());
+        if (found == generator_sources.end()) {
+            generator_sources.push_back(i);
+            generator_sizes.push_back(0);
+        }
+        ++generator_sizes[source_generators[i]];
+    }
+
+    const std::uint64_t entries { sources.size() * baby_steps };
+    // About one entry per bucket.
+    const unsigned bucket_bits { std::max(static_cast<unsigned>(std::bit_width(entries)), 2U) - 1 };
+    std::vector<std::uint64_t> words {
+        detail::fingerprint_magic, detail::fingerprint_version, generator_sources.size(), sources.size(),
+        baby_steps, giant_steps, bucket_bits, entries
+    };
+    words.reserve(detail::fingerprint_index_words(words));
+
+    for (std::size_t g { 0 }; g != generator_sources.size(); ++g) {
+        const FingerprintSource& source { sources[generator_sources[g]] };
+        const std::optional<LCGAffineTransform<std::uint64_t>> giant { source.affine.powered(baby_steps).inverse() };
+        assert(giant.has_value());
+        words.insert(words.end(), {
+            source.affine.a(), source.affine.c(), source.affine.m(), source.projection.shift(), source.projection.bits(),
+            giant->a(), giant->c(), generator_sizes[g]
+        });
+    }
+    for (std::size_t i { 0 }; i != sources.size(); ++i) {
+        words.insert(words.end(), { source_generators[i], sources[i].affine.modder()(sources[i].seed) });
+    }
+
+    // Counting sort of the entries by bucket: count, then turn the counts into starts.
+    const std::size_t buckets_begin { words.size() };
+    const std::size_t bucket_count { std::size_t { 1 } << bucket_bits };
+    words.resize(buckets_begin + bucket_count + 1);
+    const auto for_each_entry {
+        [&sources, baby_steps](auto&& f) -> void {
+            for (std::size_t i { 0 }; i != sources.size(); ++i) {
+                std::uint64_t state { sources[i].affine.modder()(sources[i].seed) };
+                for (std::uint64_t j { 0 }; j != baby_steps; ++j) {
+                    state = sources[i].affine(state);
+                    f(state, (static_cast<std::uint64_t>(i) << 32U) | j);
+                }
+            }
+        }
+    };
+    for_each_entry([&words, buckets_begin, bucket_bits](std::uint64_t state, std::uint64_t) {
+        ++words[buckets_begin + detail::fingerprint_bucket(state, bucket_bits) + 1];
+    });
+    for (std::size_t b { 0 }; b != bucket_count; ++b) {
+        words[buckets_begin + b + 1] += words[buckets_begin + b];
+    }
+    const std::size_t entries_begin { words.size() };
+    words.resize(entries_begin + (detail::fingerprint_entry_words * entries));
+    std::vector<std::uint64_t> next(words.begin() + static_cast<std::ptrdiff_t>(buckets_begin), words.begin() + static_cast<std::ptrdiff_t>(buckets_begin + bucket_count));
+    for_each_entry([&words, &next, entries_begin, bucket_bits](std::uint64_t state, std::uint64_t value) {
+        const std::uint64_t k { next[detail::fingerprint_bucket(state, bucket_bits)]++ };
+        words[entries_begin + (detail::fingerprint_entry_words * k)] = state;
+        words[entries_begin + (detail::fingerprint_entry_words * k) + 1] = value;
+    });
+    return words;
+}
+
+// Answers which sources produced some observed outputs, and where, from the words of an index. It reads the words
+// in place, so it works the same over a `std::vector` and over a mapped file, and only touches the buckets it probes.
+// For each generator, `recover_state` finds the state x after the first output. Then, if the state g giant steps
+// back from x, f^(-g * baby_steps())(x), is the state after output j of a source, the outputs start at offset
+// g * baby_steps() + j of that source. So offsets below `max_offset()` take at most `giant_steps()` probes per
+// generator, whatever the number of seeds.
+class FingerprintIndexView {
+private:
+    std::span<const std::uint64_t> words_;
+    std::size_t generators_begin_;
+    std::size_t sources_begin_;
+    std::size_t buckets_begin_;
+    std::size_t entries_begin_;
+
+    [[nodiscard]] constexpr auto header(std::size_t i) const noexcept -> std::uint64_t { return words_[i]; }
+    [[nodiscard]] constexpr auto generator(std::size_t g, std::size_t i) const noexcept -> std::uint64_t
+    {
+        return words_[generators_begin_ + (detail::fingerprint_generator_words * g) + i];
+    }
+    [[nodiscard]] constexpr auto source_generator(std::size_t i) const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(words_[sources_begin_ + (detail::fingerprint_source_words * i)]);
+    }
+
+public:
+    // Require: `words` be an index, as returned by `build_fingerprint_index`, or at least pass
+    // `detail::fingerprint_index_words` and `detail::fingerprint_records_valid`.
+    explicit constexpr FingerprintIndexView(std::span<const std::uint64_t> words) noexcept
+        : words_ { words }
+        , generators_begin_ { detail::fingerprint_header_words }
+        , sources_begin_ { generators_begin_ + (detail::fingerprint_generator_words * words[2]) }
+        , buckets_begin_ { sources_begin_ + (detail::fingerprint_source_words * words[3]) }
+        , entries_begin_ { buckets_begin_ + (std::size_t { 1 } << words[6]) + 1 }
+    {
+        assert(detail::fingerprint_index_words(words) == words.size());
+    }
+
+    [[nodiscard]] constexpr auto words() const noexcept -> std::span<const std::uint64_t> { return words_; }
+    [[nodiscard]] constexpr auto generator_count() const noexcept -> std::size_t { return static_cast<std::size_t>(this->header(2)); }
+    [[nodiscard]] constexpr auto source_count() const noexcept -> std::size_t { return static_cast<std::size_t>(this->header(3)); }
+    [[nodiscard]] constexpr auto baby_steps() const noexcept -> std::uint64_t { return this->header(4); }
+    [[nodiscard]] constexpr auto giant_steps() const noexcept -> std::uint64_t { return this->header(5); }
+    [[nodiscard]] constexpr auto entry_count() const noexcept -> std::uint64_t { return this->header(7); }
+    // Offsets below it are found.
+    [[nodiscard]] constexpr auto max_offset() const noexcept -> std::uint64_t { return this->baby_steps() * this->giant_steps(); }
+
+    [[nodiscard]] constexpr auto source(std::size_t i) const noexcept -> FingerprintSource
+    {
+        const std::size_t g { this->source_generator(i) };
+        return FingerprintSource {
+            LCGAffineTransform<std::uint64_t> { this->generator(g, 0), this->generator(g, 1), this->generator(g, 2) },
+            LCGProjection<std::uint64_t> { static_cast<unsigned>(this->generator(g, 3)), static_cast<unsigned>(this->generator(g, 4)) },
+            words_[sources_begin_ + (detail::fingerprint_source_words * i) + 1],
+        };
+    }
+
+    // Returns, for each source that produces `outputs` at an offset below `max_offset()`, the first such offset,
+    // in increasing order of source.
+    // Give enough outputs for `recover_state` to find a unique state: 3 are enough for the presets.
+    // Time complexity: O(generator_count() * (giant_steps() + time of `recover_state`)), with O(1) entries per bucket.
+    [[nodiscard]] constexpr auto find(std::span<const std::uint64_t> outputs) const -> std::vector<FingerprintMatch>
+    {
+        std::vector<FingerprintMatch> result {};
+        if (outputs.empty()) {
+            return result;
+        }
+        const auto bucket_bits { static_cast<unsigned>(this->header(6)) };
+        for (std::size_t g { 0 }; g != this->generator_count(); ++g) {
+            const LCGAffineTransform<std::uint64_t> affine { this->generator(g, 0), this->generator(g, 1), this->generator(g, 2) };
+            const LCGProjection<std::uint64_t> projection { static_cast<unsigned>(this->generator(g, 3)), static_cast<unsigned>(this->generator(g, 4)) };
+            if (std::ranges::any_of(outputs, [&projection](std::uint64_t output) { return output > projection.max(); })) {
+                continue;
+            }
+            const std::optional<std::uint64_t> state { recover_state(affine, projection, outputs) };
+            if (!state.has_value()) {
+                continue;
+            }
+
+            const LCGAffineTransform<std::uint64_t> giant { this->generator(g, 5), this->generator(g, 6), affine.m() };
+            const std::size_t first_match { result.size() };
+            const std::uint64_t sources { this->generator(g, 7) };
+            std::uint64_t x { *state };
+            for (std::uint64_t i { 0 }; i != this->giant_steps() && result.size() - first_match != sources; ++i, x = giant(x)) {
+                const std::size_t bucket { buckets_begin_ + detail::fingerprint_bucket(x, bucket_bits) };
+                const std::uint64_t last { std::min(words_[bucket + 1], this->entry_count()) };
+                for (std::uint64_t k { words_[bucket] }; k < last; ++k) {
+                    const std::size_t entry { entries_begin_ + static_cast<std::size_t>(detail::fingerprint_entry_words * k) };
+                    const auto source { static_cast<std::size_t>(words_[entry + 1] >> 32U) };
+                    if (words_[entry] != x || source >= this->source_count() || this->source_generator(source) != g) {
+                        continue;
+                    }
+                    const FingerprintMatch match { source, (i * this->baby_steps()) + (words_[entry + 1] & 0xffff'ffffU) };
+                    // An earlier giant step gives a smaller offset; a period below `baby_steps()` gives several
+                    // baby steps in one.
+                    const auto found { std::ranges::find(result.begin() + static_cast<std::ptrdiff_t>(first_match), result.end(), source, &FingerprintMatch::source) };
+                    if (found == result.end()) {
+                        result.push_back(match);
+                    } else {
+                        found->offset = std::min(found->offset, match.offset);
+                    }
+                }
+            }
+        }
+        std::ranges::sort(result, {}, &FingerprintMatch::source);
+        return result;
+    }
+};
+
+// Writes the words of an index to `path`, in the byte order of this machine. Returns whether it succeeded.
+[[nodiscard]] inline auto write_fingerprint_index(const std::filesystem::path& path, std::span<const std::uint64_t> words) -> bool
+{
+    std::ofstream file { path, std::ios::binary | std::ios::trunc };
+    file.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size_bytes())); // NOLINT : bytes of the words, as they are mapped back.
+    return static_cast<bool>(file.flush());
+}
+
+// An index in a file written by `write_fingerprint_index`. The file is mapped into memory, not read: opening it
+// reads only the generators and sources, and a query loads only the pages of the buckets it probes. Where `mmap` is not
+// available, the file is read into memory instead.
+class MappedFingerprintIndex {
+private:
+#if __has_include(<sys/mman.h>)
+    struct Unmap {
+        std::size_t size;
+
+        auto operator()(void* address) const noexcept -> void
+        {
+            ::munmap(address, size);
+        }
+    };
+
+    std::unique_ptr<void, Unmap> mapping_;
+#else
+    std::vector<std::uint64_t> words_;
+#endif
+    FingerprintIndexView view_;
+
+#if __has_include(<sys/mman.h>)
+    MappedFingerprintIndex(std::unique_ptr<void, Unmap> mapping, std::span<const std::uint64_t> words) noexcept
+        : mapping_ { std::move(mapping) }
+        , view_ { words }
+    {
+    }
+#else
+    explicit MappedFingerprintIndex(std::vector<std::uint64_t> words) noexcept
+        : words_ { std::move(words) }
+        , view_ { words_ }
+    {
+    }
+#endif
+
+public:
+    // Move-only in both configurations: `view_` points into the mapping, or into `words_`, which a copy would not
+    // update. A move keeps the mapping, and the buffer of `words_`, where they are.
+    MappedFingerprintIndex(const MappedFingerprintIndex&) = delete;
+    MappedFingerprintIndex(MappedFingerprintIndex&&) noexcept = default;
+    auto operator=(const MappedFingerprintIndex&) -> MappedFingerprintIndex& = delete;
+    auto operator=(MappedFingerprintIndex&&) noexcept -> MappedFingerprintIndex& = default;
+    ~MappedFingerprintIndex() = default;
+
+    // Returns the index in `path`, or `std::nullopt` if it cannot be opened or is not an index.
+    // The header, generators and sources are checked, not the buckets and entries, so opening reads
+    // O(generator count + source count) words: a file changed after it was written gives wrong answers, not
+    // out-of-bounds reads or undefined shifts. The file must not change while it is mapped.
+    [[nodiscard]] static auto open(const std::filesystem::path& path) -> std::optional<MappedFingerprintIndex>
+    {
+#if __has_include(<sys/mman.h>)
+        const int file { ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+        if (file < 0) {
+            return std::nullopt;
+        }
+        struct stat status { };
+        const bool has_size { ::fstat(file, &status) == 0 && status.st_size > 0 };
+        const std::size_t size { has_size ? static_cast<std::size_t>(status.st_size) : 0 };
+        void* const address { has_size ? ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0) : MAP_FAILED };
+        ::close(file);
+        if (address == MAP_FAILED) { // NOLINT : `MAP_FAILED` is a C-style cast.
+            return std::nullopt;
+        }
+        std::unique_ptr<void, Unmap> mapping { address, Unmap { size } };
+        // `mmap` returns page-aligned memory, which holds the words as they were written.
+        const std::span<const std::uint64_t> words { static_cast<const std::uint64_t*>(address), size / sizeof(std::uint64_t) };
+        if (size % sizeof(std::uint64_t) != 0 || detail::fingerprint_index_words(words) != words.size()
+            || !detail::fingerprint_records_valid(words)) {
+            return std::nullopt;
+        }
+        return MappedFingerprintIndex { std::move(mapping), words };
+#else
+        std::ifstream file { path, std::ios::binary | std::ios::ate };
+        if (!file) {
+            return std::nullopt;
+        }
+        const auto size { static_cast<std::size_t>(file.tellg()) };
+        std::vector<std::uint64_t> words(size / sizeof(std::uint64_t));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(size)); // NOLINT : bytes of the words, as they were written.
+        if (!file || size % sizeof(std::uint64_t) != 0 || detail::fingerprint_index_words(words) != words.size()
+            || !detail::fingerprint_records_valid(words)) {
+            return std::nullopt;
+        }
+        return MappedFingerprintIndex { std::move(words) };
+#endif
+    }
+
+    [[nodiscard]] auto view() const noexcept -> const FingerprintIndexView& { return view_; }
+
+    [[nodiscard]] auto find(std::span<const std::uint64_t> outputs) const -> std::vector<FingerprintMatch>
+    {
+        return view_.find(outputs);
+    }
+};
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_FINGERPRINT_HPP_INCLUDED
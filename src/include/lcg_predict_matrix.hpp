@@ -0,0 +1,427 @@
+// 2026-10  lcg_predict_matrix.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_MATRIX_HPP_INCLUDED
+#define LCG_PREDICT_MATRIX_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace ls_hower::lcg_predict::detail {
+
+// An engine that can jump ahead: `LCGEngine` and `MatrixLCGEngine`.
+template <typename Engine>
+concept jumpable_engine = requires(Engine engine, const Engine& const_engine, unsigned long long n) {
+    typename Engine::result_type;
+    { engine() } -> std::same_as<typename Engine::result_type>;
+    { const_engine.value_after_n_steps(n) } -> std::same_as<typename Engine::result_type>;
+    { const_engine.m() } -> std::same_as<typename Engine::result_type>;
+    engine.discard(n);
+};
+
+} // namespace ls_hower::lcg_predict::detail
+
+namespace ls_hower::lcg_predict {
+
+// The transformation x -> (Ax + c) mod m of vectors of `K` values, where A is a K x K matrix.
+// With K == 1, this is an `LCGAffineTransform`. A multiple recursive generator x_n = a_1 x_(n-1) + ... + a_K x_(n-K)
+// is the case where A is the companion matrix of its coefficients and c == 0.
+// As for `LCGAffineTransform`, f^n is computed by `detail::double_and_add` from the composition, in O(K^3 log(n)).
+template <detail::unsigned_integer_like UIntType, std::size_t K>
+    requires (K >= 1)
+class MatrixLCGTransform {
+public:
+    using result_type = UIntType;
+    using vector_type = std::array<UIntType, K>;
+    using matrix_type = std::array<vector_type, K>;
+
+private:
+    using UnsignedBigger = detail::least_doubled_uint_t<UIntType>;
+
+    detail::UnsignedModder<UIntType> modder_;
+    // Whether K products of residues, and a residue, add up without wrapping in `UnsignedBigger`, so that a dot
+    // product needs one reduction instead of one per term.
+    bool lazy_;
+    // Whether rows 1 to K - 1 only shift x down, as for a multiple recursive generator, so that a step computes
+    // one dot product instead of K.
+    bool companion_;
+    matrix_type a_;
+    vector_type c_;
+
+    [[nodiscard]] static constexpr auto choose_lazy(UIntType m) noexcept -> bool
+    {
+        return m != 0 && (2 * detail::bit_width(static_cast<UIntType>(m - 1U))) + detail::bit_width(K + 1) <= std::numeric_limits<UnsignedBigger>::digits;
+    }
+
+    [[nodiscard]] static constexpr auto choose_companion(const matrix_type& a, const vector_type& c) noexcept -> bool
+    {
+        for (std::size_t i { 1 }; i != K; ++i) {
+            for (std::size_t j { 0 }; j != K; ++j) {
+                if (a[i][j] != (j + 1 == i ? 1U : 0U)) {
+                    return false;
+                }
+            }
+            if (c[i] != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns (row . x + z) mod m.
+    [[nodiscard]] constexpr auto dot_plus(const vector_type& row, const vector_type& x, UIntType z) const noexcept -> UIntType
+    {
+        if (lazy_) {
+            UnsignedBigger sum { z };
+            for (std::size_t j { 0 }; j != K; ++j) {
+                sum += static_cast<UnsignedBigger>(row[j]) * x[j];
+            }
+            return modder_(sum);
+        }
+        for (std::size_t j { 0 }; j != K; ++j) {
+            z = modder_.times_plus_mod(row[j], x[j], z);
+        }
+        return z;
+    }
+
+public:
+    explicit constexpr MatrixLCGTransform(const matrix_type& a, const vector_type& c, UIntType m = 0) noexcept // NOLINT : order of triplet (a, c, m) is conventional, not easily swappable.
+        : modder_ { m }
+        , lazy_ { choose_lazy(m) }
+        , companion_ { false }
+        , a_ { a }
+        , c_ { c }
+    {
+        for (std::size_t i { 0 }; i != K; ++i) {
+            for (std::size_t j { 0 }; j != K; ++j) {
+                a_[i][j] = modder_(a_[i][j]);
+            }
+            c_[i] = modder_(c_[i]);
+        }
+        companion_ = choose_companion(a_, c_);
+    }
+
+    // The multiple recursive generator x_n = (a_1 x_(n-1) + ... + a_K x_(n-K)) mod m, on vectors holding
+    // (x_(n-1), ..., x_(n-K)), newest first. Negative coefficients are given as m - |a_i|.
+    [[nodiscard]] static constexpr auto multiple_recursive(const vector_type& coefficients, UIntType m) noexcept -> MatrixLCGTransform
+    {
+        matrix_type a {};
+        a[0] = coefficients;
+        for (std::size_t i { 1 }; i != K; ++i) {
+            a[i][i - 1] = 1U;
+        }
+        return MatrixLCGTransform { a, vector_type {}, m };
+    }
+
+    [[nodiscard]] constexpr auto a() const noexcept -> const matrix_type& { return a_; }
+    [[nodiscard]] constexpr auto c() const noexcept -> const vector_type& { return c_; }
+    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return modder_.m(); }
+    [[nodiscard]] constexpr auto modder() const noexcept -> const detail::UnsignedModder<UIntType>& { return modder_; }
+
+    [[nodiscard]] constexpr auto operator()(const vector_type& x) const noexcept -> vector_type
+    {
+        vector_type result {};
+        if (companion_) {
+            result[0] = this->dot_plus(a_[0], x, c_[0]);
+            for (std::size_t i { 1 }; i != K; ++i) {
+                result[i] = x[i - 1];
+            }
+            return result;
+        }
+        for (std::size_t i { 0 }; i != K; ++i) {
+            result[i] = this->dot_plus(a_[i], x, c_[i]);
+        }
+        return result;
+    }
+
+    // Makes `*this` the transform x -> f(g(x)), where f is `*this` and g is `rhs`: (A_f A_g, A_f c_g + c_f).
+    constexpr auto compose_assign(const MatrixLCGTransform& rhs) noexcept -> MatrixLCGTransform&
+    {
+        assert(modder_ == rhs.modder_);
+        // Columns of A_g are read as rows of its transpose, so that every dot product runs along contiguous arrays.
+        matrix_type rhs_columns {};
+        for (std::size_t i { 0 }; i != K; ++i) {
+            for (std::size_t j { 0 }; j != K; ++j) {
+                rhs_columns[j][i] = rhs.a_[i][j];
+            }
+        }
+        matrix_type new_a {};
+        vector_type new_c {};
+        for (std::size_t i { 0 }; i != K; ++i) {
+            for (std::size_t j { 0 }; j != K; ++j) {
+                new_a[i][j] = this->dot_plus(a_[i], rhs_columns[j], 0U);
+            }
+            new_c[i] = this->dot_plus(a_[i], rhs.c_, c_[i]);
+        }
+        a_ = new_a;
+        c_ = new_c;
+        companion_ = choose_companion(a_, c_);
+        return *this;
+    }
+
+    // Returns f such that f(x) = lhs(rhs(x)).
+    [[nodiscard]] friend constexpr auto compose(MatrixLCGTransform lhs, const MatrixLCGTransform& rhs) noexcept -> MatrixLCGTransform
+    {
+        lhs.compose_assign(rhs);
+        return lhs;
+    }
+
+    [[nodiscard]] constexpr auto identity() const noexcept -> MatrixLCGTransform
+    {
+        // Copy the modder rather than constructing it again, which would recompute its reciprocal.
+        MatrixLCGTransform result { *this };
+        for (std::size_t i { 0 }; i != K; ++i) {
+            result.a_[i].fill(0U);
+            result.a_[i][i] = modder_(1U);
+        }
+        result.c_.fill(0U);
+        result.companion_ = choose_companion(result.a_, result.c_);
+        return result;
+    }
+
+    // Time complexity: O(K^3 log(n)).
+    [[nodiscard]] constexpr auto powered(unsigned long long n) const noexcept -> MatrixLCGTransform
+    {
+        const auto composer {
+            [](const MatrixLCGTransform& lhs, const MatrixLCGTransform& rhs) noexcept -> MatrixLCGTransform {
+                return compose(lhs, rhs);
+            }
+        };
+        return detail::double_and_add(*this, n, composer, this->identity());
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const MatrixLCGTransform& lhs, const MatrixLCGTransform& rhs) noexcept -> bool = default;
+};
+
+// A `MatrixLCGTransform` and a state vector. Each call of `operator()` applies the transform to the state and
+// returns its first component, which for a multiple recursive generator is the newest value.
+template <detail::unsigned_integer_like UIntType, std::size_t K>
+class MatrixLCGEngine {
+public:
+    using result_type = UIntType;
+    using transform_type = MatrixLCGTransform<UIntType, K>;
+    using vector_type = typename transform_type::vector_type;
+
+private:
+    transform_type transform_;
+    vector_type state_;
+
+    [[nodiscard]] constexpr auto reduced(vector_type x) const noexcept -> vector_type
+    {
+        for (result_type& value : x) {
+            value = transform_.modder()(value);
+        }
+        return x;
+    }
+
+public:
+    explicit constexpr MatrixLCGEngine(const transform_type& transform, const vector_type& state) noexcept
+        : transform_ { transform }
+        , state_ { this->reduced(state) }
+    {
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        state_ = transform_(state_);
+        return state_[0];
+    }
+
+    // Time complexity: O(K^3 log(n)).
+    [[nodiscard]] constexpr auto state_after_n_steps(unsigned long long steps) const noexcept -> vector_type
+    {
+        return transform_.powered(steps)(state_);
+    }
+
+    // Time complexity: O(K^3 log(n)).
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
+    {
+        return this->state_after_n_steps(steps)[0];
+    }
+
+    // Time complexity: O(K^3 log(n)).
+    constexpr auto discard(unsigned long long n) noexcept -> void
+    {
+        state_ = this->state_after_n_steps(n);
+    }
+
+    // Fills `out` with the next `out.size()` values of `operator()`.
+    constexpr auto generate(std::span<result_type> out) noexcept -> void
+    {
+        for (result_type& value : out) {
+            value = (*this)();
+        }
+    }
+
+    // Returns a copy of the engine for worker `i` of `k`, when the next `k * block_len` values are dealt out in
+    // blocks: its next value is value `i * block_len`, counting the next value as 0.
+    // Require: `i < k`.
+    // Time complexity: O(K^3 log(i * block_len)).
+    [[nodiscard]] constexpr auto split_block(unsigned long long k, unsigned long long i, unsigned long long block_len) const noexcept -> MatrixLCGEngine
+    {
+        assert(i < k);
+        assert(block_len == 0 || i <= std::numeric_limits<unsigned long long>::max() / block_len);
+        MatrixLCGEngine result { *this };
+        result.discard(i * block_len);
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto transform() const noexcept -> const transform_type& { return transform_; }
+    [[nodiscard]] constexpr auto m() const noexcept -> UIntType { return transform_.m(); }
+    [[nodiscard]] constexpr auto state() const noexcept -> const vector_type& { return state_; }
+    constexpr auto set_state(const vector_type& new_state) noexcept -> void { state_ = this->reduced(new_state); }
+
+    [[nodiscard]] friend constexpr auto operator==(const MatrixLCGEngine& lhs, const MatrixLCGEngine& rhs) noexcept -> bool = default;
+};
+
+// Several engines stepped together, whose values are combined as in L'Ecuyer's combined generators:
+// z = (x_1 - x_2 + x_3 - ...) mod `modulus`, returned as `modulus` when it is 0, so the values lie in [1, modulus].
+// Each component jumps on its own, so a jump costs the sum of the jumps of the components.
+// See: P. L'Ecuyer. Efficient and portable combined random number generators. Commun. ACM, 1988.
+template <detail::jumpable_engine Engine, std::size_t N>
+    requires (N >= 1)
+class CombinedLCGEngine {
+public:
+    using result_type = typename Engine::result_type;
+    using engine_type = Engine;
+
+private:
+    std::array<Engine, N> engines_;
+    detail::UnsignedModder<result_type> modder_;
+    // Whether every value of every component is below 2 * modulus, and 2 * modulus fits in `result_type`, as in
+    // L'Ecuyer's generators. Then each value needs at most one subtraction, and the combination no reduction.
+    bool near_;
+
+    [[nodiscard]] static constexpr auto choose_near(const std::array<Engine, N>& engines, result_type modulus) noexcept -> bool
+    {
+        if (modulus > std::numeric_limits<result_type>::max() / 2) {
+            return false;
+        }
+        return std::ranges::all_of(engines, [modulus](const Engine& engine) noexcept -> bool {
+            return engine.m() != 0 && engine.m() <= 2 * modulus;
+        });
+    }
+
+    template <typename Values>
+    [[nodiscard]] constexpr auto combine(const Values& values) const noexcept -> result_type
+    {
+        const result_type modulus { modder_.m() };
+        result_type z { 0 };
+        for (std::size_t j { 0 }; j != N; ++j) {
+            if (near_) {
+                const result_type x { values[j] >= modulus ? static_cast<result_type>(values[j] - modulus) : values[j] };
+                if (j % 2 == 0) {
+                    z = static_cast<result_type>(z + x);
+                    z = z >= modulus ? static_cast<result_type>(z - modulus) : z;
+                } else {
+                    z = z >= x ? static_cast<result_type>(z - x) : static_cast<result_type>(z + (modulus - x));
+                }
+            } else {
+                const result_type x { modder_(values[j]) };
+                z = j % 2 == 0 ? modder_.plus_mod(z, x) : modder_.minus_mod(z, x);
+            }
+        }
+        return z != 0 ? z : modulus;
+    }
+
+public:
+    // Require: `modulus != 0`.
+    explicit constexpr CombinedLCGEngine(const std::array<Engine, N>& engines, result_type modulus) noexcept
+        : engines_ { engines }
+        , modder_ { modulus }
+        , near_ { choose_near(engines, modulus) }
+    {
+        assert(modulus != 0);
+    }
+
+    [[nodiscard]] constexpr auto operator()() noexcept -> result_type
+    {
+        std::array<result_type, N> values {};
+        for (std::size_t j { 0 }; j != N; ++j) {
+            values[j] = engines_[j]();
+        }
+        return this->combine(values);
+    }
+
+    [[nodiscard]] constexpr auto value_after_n_steps(unsigned long long steps) const noexcept -> result_type
+    {
+        std::array<result_type, N> values {};
+        for (std::size_t j { 0 }; j != N; ++j) {
+            values[j] = engines_[j].value_after_n_steps(steps);
+        }
+        return this->combine(values);
+    }
+
+    constexpr auto discard(unsigned long long n) noexcept -> void
+    {
+        for (Engine& engine : engines_) {
+            engine.discard(n);
+        }
+    }
+
+    // Fills `out` with the next `out.size()` values of `operator()`.
+    constexpr auto generate(std::span<result_type> out) noexcept -> void
+    {
+        for (result_type& value : out) {
+            value = (*this)();
+        }
+    }
+
+    // Same as `MatrixLCGEngine::split_block`.
+    [[nodiscard]] constexpr auto split_block(unsigned long long k, unsigned long long i, unsigned long long block_len) const noexcept -> CombinedLCGEngine
+    {
+        assert(i < k);
+        assert(block_len == 0 || i <= std::numeric_limits<unsigned long long>::max() / block_len);
+        CombinedLCGEngine result { *this };
+        result.discard(i * block_len);
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto engines() const noexcept -> const std::array<Engine, N>& { return engines_; }
+    [[nodiscard]] constexpr auto modulus() const noexcept -> result_type { return modder_.m(); }
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return 1U; }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return modder_.m(); }
+
+    [[nodiscard]] friend constexpr auto operator==(const CombinedLCGEngine& lhs, const CombinedLCGEngine& rhs) noexcept -> bool = default;
+};
+
+// MRG32k3a, with every seed 12345 as in L'Ecuyer's RngStreams. Values divided by m_1 + 1 = 4294967088 give its
+// floating-point outputs.
+// See: P. L'Ecuyer. Good parameters and implementations for combined multiple recursive random number generators.
+// Oper. Res., 1999.
+constexpr inline CombinedLCGEngine<MatrixLCGEngine<std::uint_fast64_t, 3>, 2> mrg32k3a_engine {
+    {
+        MatrixLCGEngine<std::uint_fast64_t, 3> {
+            MatrixLCGTransform<std::uint_fast64_t, 3>::multiple_recursive({ 0, 1403580, 4294967087 - 810728 }, 4294967087),
+            { 12345, 12345, 12345 },
+        },
+        MatrixLCGEngine<std::uint_fast64_t, 3> {
+            MatrixLCGTransform<std::uint_fast64_t, 3>::multiple_recursive({ 527612, 0, 4294944443 - 1370589 }, 4294944443),
+            { 12345, 12345, 12345 },
+        },
+    },
+    4294967087,
+};
+
+// L'Ecuyer's combination of two multiplicative LCGs, with both seeds 12345. Values divided by m_1 = 2147483563
+// give its floating-point outputs.
+constexpr inline CombinedLCGEngine<LCGEngine<std::uint_fast64_t>, 2> lecuyer1988_engine {
+    {
+        LCGEngine<std::uint_fast64_t> { 40014, 0, 2147483563, 12345 },
+        LCGEngine<std::uint_fast64_t> { 40692, 0, 2147483399, 12345 },
+    },
+    2147483562,
+};
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_MATRIX_HPP_INCLUDED
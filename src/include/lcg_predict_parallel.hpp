@@ -0,0 +1,203 @@
+// 2026-10  lcg_predict_parallel.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_PARALLEL_HPP_INCLUDED
+#define LCG_PREDICT_PARALLEL_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+#include "lcg_predict_segments.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ls_hower::lcg_predict::detail {
+
+// Returns the index of the first value of block `i`, when `n` values are split into `blocks` contiguous blocks
+// whose sizes differ by at most one.
+[[nodiscard]] constexpr auto block_begin(std::size_t n, std::size_t blocks, std::size_t i) noexcept -> std::size_t
+{
+    return ((n / blocks) * i) + std::min(i, n % blocks);
+}
+
+// Fills block `i` of `out` with the values `engine` would produce at those positions.
+template <std::unsigned_integral UIntType>
+constexpr auto fill_block(const LCGEngine<UIntType>& engine, std::span<UIntType> out, std::size_t blocks, std::size_t i) noexcept -> void
+{
+    const std::size_t begin { block_begin(out.size(), blocks, i) };
+    const std::size_t end { block_begin(out.size(), blocks, i + 1) };
+    LCGEngine<UIntType> block_engine { engine };
+    block_engine.discard(begin);
+    block_engine.generate(out.subspan(begin, end - begin));
+}
+
+// Writes the values at block `i` of `indices` to the same block of `out`.
+template <std::unsigned_integral UIntType, std::unsigned_integral Index, unsigned WindowBits>
+constexpr auto values_at_block(const LCGEngine<UIntType>& engine, std::span<const Index> indices, std::span<UIntType> out,
+    const LCGJumpTable<UIntType, WindowBits>& table, std::size_t blocks, std::size_t i) noexcept -> void
+{
+    const std::size_t begin { block_begin(indices.size(), blocks, i) };
+    const std::size_t end { block_begin(indices.size(), blocks, i + 1) };
+    engine.values_at(indices.subspan(begin, end - begin), out.subspan(begin, end - begin), table);
+}
+
+// Writes the transforms of segments [begin, i] to out[i], for every i in block `i` of `segments`. Together with
+// the transforms of the blocks before it, these are the prefixes of `prefix_compositions`.
+template <unsigned_integer_like UIntType>
+constexpr auto prefix_compositions_block(std::span<const LCGSegment<UIntType>> segments, std::span<LCGAffineTransform<UIntType>> out,
+    std::size_t blocks, std::size_t i) noexcept -> void
+{
+    const std::size_t begin { block_begin(segments.size(), blocks, i) };
+    const std::size_t end { block_begin(segments.size(), blocks, i + 1) };
+    prefix_compositions(segments.subspan(begin, end - begin), out.subspan(begin, end - begin));
+}
+
+// Calls `block(i)` for every i in [0, blocks): block 0 on the calling thread and every other block on a thread of its own.
+// Not `constexpr`, as it defines `std::jthread`s.
+template <std::invocable<std::size_t> Block>
+auto run_blocks_concurrently(std::size_t blocks, const Block& block) noexcept(false) -> void
+{
+    std::vector<std::jthread> threads {};
+    threads.reserve(blocks - 1);
+    for (std::size_t i { 1 }; i != blocks; ++i) {
+        threads.emplace_back([&block, i] { block(i); });
+    }
+    block(0);
+    // The destructors of `threads` join them.
+}
+
+// Same as `fill_block` for every block, concurrently.
+template <std::unsigned_integral UIntType>
+auto fill_blocks_concurrently(const LCGEngine<UIntType>& engine, std::span<UIntType> out, std::size_t blocks) noexcept(false) -> void
+{
+    run_blocks_concurrently(blocks, [&engine, out, blocks](std::size_t i) { fill_block(engine, out, blocks, i); });
+}
+
+} // namespace ls_hower::lcg_predict::detail
+
+namespace ls_hower::lcg_predict {
+
+// Below this many values per thread, starting a thread costs more than it saves.
+constexpr inline std::size_t parallel_min_block_size { std::size_t { 1 } << 16 };
+
+// The same for `parallel_values_at` and `parallel_prefix_compositions`, where each value costs a jump rather than a step.
+constexpr inline std::size_t parallel_min_query_block_size { std::size_t { 1 } << 10 };
+
+// Same as `engine.generate(out)`, but `out` is split into at most `thread_count` contiguous blocks of at least
+// `min_block_size` values, filled concurrently. Each block starts from `engine.value_after_n_steps(block_begin)`,
+// so the result does not depend on the number of threads.
+// If a thread cannot be started, `std::system_error` is thrown, and `engine` is not advanced.
+// During constant evaluation, the blocks are filled one after another.
+template <std::unsigned_integral UIntType>
+constexpr auto parallel_generate(LCGEngine<UIntType>& engine, std::span<UIntType> out,
+    std::size_t thread_count = std::thread::hardware_concurrency(),
+    std::size_t min_block_size = parallel_min_block_size) noexcept(false) -> void
+{
+    const std::size_t blocks { std::clamp<std::size_t>(out.size() / std::max<std::size_t>(min_block_size, 1), 1, std::max<std::size_t>(thread_count, 1)) };
+    if (std::is_constant_evaluated() || blocks == 1) {
+        for (std::size_t i { 0 }; i != blocks; ++i) {
+            detail::fill_block(engine, out, blocks, i);
+        }
+    } else {
+        detail::fill_blocks_concurrently(engine, out, blocks);
+    }
+    engine.discard(out.size());
+}
+
+// Same as `engine.values_at(indices, out, table)`, but `indices` is split into at most `thread_count` contiguous
+// blocks of at least `min_block_size` indices, answered concurrently.
+// If a thread cannot be started, `std::system_error` is thrown.
+// During constant evaluation, the blocks are answered one after another.
+template <std::unsigned_integral UIntType, detail::step_count_range Indices, unsigned WindowBits>
+constexpr auto parallel_values_at(const LCGEngine<UIntType>& engine, const Indices& indices, std::span<UIntType> out,
+    const LCGJumpTable<UIntType, WindowBits>& table,
+    std::size_t thread_count = std::thread::hardware_concurrency(),
+    std::size_t min_block_size = parallel_min_query_block_size) noexcept(false) -> void
+{
+    const std::span<const std::ranges::range_value_t<Indices>> index_view { indices };
+    assert(index_view.size() == out.size());
+    const std::size_t blocks { std::clamp<std::size_t>(index_view.size() / std::max<std::size_t>(min_block_size, 1), 1, std::max<std::size_t>(thread_count, 1)) };
+    if (std::is_constant_evaluated() || blocks == 1) {
+        for (std::size_t i { 0 }; i != blocks; ++i) {
+            detail::values_at_block(engine, index_view, out, table, blocks, i);
+        }
+    } else {
+        detail::run_blocks_concurrently(blocks, [&engine, index_view, out, &table, blocks](std::size_t i) {
+            detail::values_at_block(engine, index_view, out, table, blocks, i);
+        });
+    }
+}
+
+// Same as the above, with a radix-16 `LCGJumpTable` built once for all the threads.
+template <std::unsigned_integral UIntType, detail::step_count_range Indices>
+constexpr auto parallel_values_at(const LCGEngine<UIntType>& engine, const Indices& indices, std::span<UIntType> out,
+    std::size_t thread_count = std::thread::hardware_concurrency(),
+    std::size_t min_block_size = parallel_min_query_block_size) noexcept(false) -> void
+{
+    parallel_values_at(engine, indices, out, LCGJumpTable<UIntType, 4> { engine.affine() }, thread_count, min_block_size);
+}
+
+// Same as `prefix_compositions(segments, out)`, but `segments` is split into at most `thread_count` contiguous
+// blocks of at least `min_block_size` segments, scanned in three passes:
+// each block's own prefixes, concurrently; then the transform of all the blocks before each block, one after
+// another; then each block's prefixes composed after that, concurrently. The last pass costs one composition per
+// segment, against O(log(count)) for the first.
+// If a thread cannot be started, `std::system_error` is thrown.
+// During constant evaluation, the blocks are scanned one after another.
+template <detail::unsigned_integer_like UIntType>
+constexpr auto parallel_prefix_compositions(std::span<const LCGSegment<UIntType>> segments, std::span<LCGAffineTransform<UIntType>> out,
+    std::size_t thread_count = std::thread::hardware_concurrency(),
+    std::size_t min_block_size = parallel_min_query_block_size) noexcept(false) -> void
+{
+    assert(segments.size() == out.size());
+    const std::size_t blocks { std::clamp<std::size_t>(segments.size() / std::max<std::size_t>(min_block_size, 1), 1, std::max<std::size_t>(thread_count, 1)) };
+    const auto scan_block {
+        [segments, out, blocks](std::size_t i) noexcept -> void {
+            detail::prefix_compositions_block(segments, out, blocks, i);
+        }
+    };
+    if (std::is_constant_evaluated() || blocks == 1) {
+        for (std::size_t i { 0 }; i != blocks; ++i) {
+            scan_block(i);
+        }
+    } else {
+        detail::run_blocks_concurrently(blocks, scan_block);
+    }
+    if (blocks == 1) {
+        return;
+    }
+
+    // carries[i] is the transform of all the blocks before block i + 1.
+    std::vector<LCGAffineTransform<UIntType>> carries {};
+    carries.reserve(blocks - 1);
+    for (std::size_t i { 1 }; i != blocks; ++i) {
+        const LCGAffineTransform<UIntType>& block_total { out[detail::block_begin(out.size(), blocks, i) - 1] };
+        carries.push_back(i == 1 ? block_total : compose(block_total, carries.back()));
+    }
+    const auto carry_block {
+        [out, blocks, &carries](std::size_t j) noexcept -> void {
+            const std::size_t end { detail::block_begin(out.size(), blocks, j + 2) };
+            for (std::size_t k { detail::block_begin(out.size(), blocks, j + 1) }; k != end; ++k) {
+                out[k] = compose(out[k], carries[j]);
+            }
+        }
+    };
+    if (std::is_constant_evaluated()) {
+        for (std::size_t j { 0 }; j != blocks - 1; ++j) {
+            carry_block(j);
+        }
+    } else {
+        detail::run_blocks_concurrently(blocks - 1, carry_block);
+    }
+}
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_PARALLEL_HPP_INCLUDED
@@ -0,0 +1,112 @@
+// 2026-10  lcg_predict_pool.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_POOL_HPP_INCLUDED
+#define LCG_PREDICT_POOL_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ls_hower::lcg_predict {
+
+// Many engines sharing one transform, stored as one contiguous array of states instead of an array of
+// `LCGEngine`s, each with its own copy of the transform.
+// Stepping every engine is one loop over the states, which the compiler vectorizes when m is a power of two,
+// and jumps of any length use one `LCGJumpTable` shared by all the engines.
+template <std::unsigned_integral UIntType, unsigned WindowBits = 4>
+class LCGEnginePool {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    using engine_type = LCGEngine<UIntType>;
+    using table_type = LCGJumpTable<UIntType, WindowBits>;
+
+private:
+    table_type table_;
+    std::vector<result_type> states_;
+
+public:
+    // `size` engines, all with state `seed`.
+    explicit constexpr LCGEnginePool(const affine_type& affine, std::size_t size = 0, result_type seed = engine_type::default_seed)
+        : table_ { affine }
+        , states_(size, affine.modder()(seed))
+    {
+    }
+
+    // One engine per value of `states`.
+    explicit constexpr LCGEnginePool(const affine_type& affine, std::vector<result_type> states)
+        : table_ { affine }
+        , states_ { std::move(states) }
+    {
+        for (result_type& state : states_) {
+            state = affine.modder()(state);
+        }
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return states_.size(); }
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return table_.affine(); }
+    [[nodiscard]] constexpr auto table() const noexcept -> const table_type& { return table_; }
+    [[nodiscard]] constexpr auto states() const noexcept -> std::span<const result_type> { return states_; }
+    [[nodiscard]] constexpr auto state(std::size_t i) const noexcept -> result_type { return states_[i]; }
+    constexpr auto set_state(std::size_t i, result_type new_seed) noexcept -> void { states_[i] = this->affine().modder()(new_seed); }
+
+    // Returns a standalone copy of engine `i`.
+    [[nodiscard]] constexpr auto engine(std::size_t i) const noexcept -> engine_type
+    {
+        return engine_type { this->affine(), states_[i] };
+    }
+
+    // Adds an engine with state `seed`.
+    constexpr auto push_back(result_type seed) -> void
+    {
+        states_.push_back(this->affine().modder()(seed));
+    }
+
+    // Same as calling `operator()` of every engine once.
+    constexpr auto step_all() noexcept -> void
+    {
+        this->affine().apply_each(states_, states_);
+    }
+
+    // Same as calling `operator()` of engine `i` once for each i where `selected[i]`.
+    // Require: `selected.size() == size()`.
+    constexpr auto step_selected(std::span<const bool> selected) noexcept -> void
+    {
+        assert(selected.size() == states_.size());
+        this->affine().apply_each_if(states_, selected);
+    }
+
+    // Same as calling `discard(n)` of every engine.
+    // Time complexity: O(number of nonzero digits of n + size()).
+    constexpr auto discard_all(unsigned long long n) noexcept -> void
+    {
+        table_.powered(n).apply_each(states_, states_);
+    }
+
+    // Same as calling `discard(n[i])` of every engine `i`.
+    // Require: `n.size() == size()`.
+    // Time complexity: O(sum over i of the number of nonzero digits of n[i]).
+    constexpr auto discard_each(std::span<const unsigned long long> n) noexcept -> void
+    {
+        assert(n.size() == states_.size());
+        for (std::size_t i { 0 }; i != states_.size(); ++i) {
+            states_[i] = table_.advance(states_[i], n[i]);
+        }
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGEnginePool& lhs, const LCGEnginePool& rhs) noexcept -> bool
+    {
+        return lhs.affine() == rhs.affine() && lhs.states_ == rhs.states_;
+    }
+};
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_POOL_HPP_INCLUDED
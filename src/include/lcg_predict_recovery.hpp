@@ -0,0 +1,225 @@
+// 2026-10  lcg_predict_recovery.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_RECOVERY_HPP_INCLUDED
+#define LCG_PREDICT_RECOVERY_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ls_hower::lcg_predict::detail {
+
+// Lattice vectors are exact. Their Gram-Schmidt orthogonalization is approximate, which only affects
+// how well the basis is reduced: every answer is checked against the outputs before being returned.
+using LatticeVector = std::vector<__int128_t>;
+using RealVector = std::vector<long double>;
+
+[[nodiscard]] constexpr auto round_to_integer(long double x) noexcept -> __int128_t
+{
+    return x >= 0 ? static_cast<__int128_t>(x + 0.5L) : -static_cast<__int128_t>(-x + 0.5L);
+}
+
+[[nodiscard]] constexpr auto to_real(const LatticeVector& v) -> RealVector
+{
+    RealVector result(v.size());
+    for (std::size_t i { 0 }; i != v.size(); ++i) {
+        result[i] = static_cast<long double>(v[i]);
+    }
+    return result;
+}
+
+[[nodiscard]] constexpr auto dot(const RealVector& lhs, const RealVector& rhs) noexcept -> long double
+{
+    long double result { 0 };
+    for (std::size_t i { 0 }; i != lhs.size(); ++i) {
+        result += lhs[i] * rhs[i];
+    }
+    return result;
+}
+
+// lhs -= factor * rhs.
+constexpr auto subtract_multiple(LatticeVector& lhs, __int128_t factor, const LatticeVector& rhs) noexcept -> void
+{
+    for (std::size_t i { 0 }; i != lhs.size(); ++i) {
+        lhs[i] -= factor * rhs[i];
+    }
+}
+
+struct GramSchmidt {
+    // orthogonal[i] = b_i - sum over j < i of mu[i][j] * orthogonal[j].
+    std::vector<RealVector> orthogonal;
+    std::vector<RealVector> mu;
+    // squared_norms[i] = |orthogonal[i]|^2.
+    RealVector squared_norms;
+};
+
+[[nodiscard]] constexpr auto gram_schmidt(const std::vector<LatticeVector>& basis) -> GramSchmidt
+{
+    const std::size_t n { basis.size() };
+    GramSchmidt result { std::vector<RealVector>(n), std::vector<RealVector>(n, RealVector(n)), RealVector(n) };
+    for (std::size_t i { 0 }; i != n; ++i) {
+        const RealVector b { to_real(basis[i]) };
+        RealVector orthogonal { b };
+        for (std::size_t j { 0 }; j != i; ++j) {
+            const long double mu { result.squared_norms[j] == 0 ? 0 : dot(b, result.orthogonal[j]) / result.squared_norms[j] };
+            result.mu[i][j] = mu;
+            for (std::size_t l { 0 }; l != orthogonal.size(); ++l) {
+                orthogonal[l] -= mu * result.orthogonal[j][l];
+            }
+        }
+        result.squared_norms[i] = dot(orthogonal, orthogonal);
+        result.orthogonal[i] = std::move(orthogonal);
+    }
+    return result;
+}
+
+// Lenstra-Lenstra-Lovasz reduction, with delta = 0.99.
+// Require: the rows of `basis` be linearly independent.
+[[nodiscard]] constexpr auto lll_reduce(std::vector<LatticeVector> basis) -> std::vector<LatticeVector>
+{
+    constexpr long double delta { 0.99L };
+    const std::size_t n { basis.size() };
+    GramSchmidt gs { gram_schmidt(basis) };
+    for (std::size_t k { 1 }; k < n; /* void */) {
+        // Size reduction: |mu[k][j]| <= 1/2 for every j < k. The orthogonal vectors do not change.
+        for (std::size_t j { k }; j-- != 0; /* void */) {
+            if (const __int128_t q { round_to_integer(gs.mu[k][j]) }; q != 0) {
+                subtract_multiple(basis[k], q, basis[j]);
+                for (std::size_t l { 0 }; l != j; ++l) {
+                    gs.mu[k][l] -= static_cast<long double>(q) * gs.mu[j][l];
+                }
+                gs.mu[k][j] -= static_cast<long double>(q);
+            }
+        }
+
+        // Lovasz condition.
+        if (gs.squared_norms[k] >= (delta - (gs.mu[k][k - 1] * gs.mu[k][k - 1])) * gs.squared_norms[k - 1]) {
+            ++k;
+        } else {
+            std::swap(basis[k], basis[k - 1]);
+            gs = gram_schmidt(basis);
+            k = k > 1 ? k - 1 : 1;
+        }
+    }
+    return basis;
+}
+
+// Returns a lattice vector close to `target`, with Babai's nearest plane algorithm.
+[[nodiscard]] constexpr auto babai_nearest_plane(const std::vector<LatticeVector>& basis, const LatticeVector& target) -> LatticeVector
+{
+    const GramSchmidt gs { gram_schmidt(basis) };
+    LatticeVector residual { target };
+    for (std::size_t i { basis.size() }; i-- != 0; /* void */) {
+        const __int128_t c { round_to_integer(dot(to_real(residual), gs.orthogonal[i]) / gs.squared_norms[i]) };
+        subtract_multiple(residual, c, basis[i]);
+    }
+    // target - residual is in the lattice.
+    LatticeVector result { target };
+    subtract_multiple(result, 1, residual);
+    return result;
+}
+
+} // namespace ls_hower::lcg_predict::detail
+
+namespace ls_hower::lcg_predict {
+
+// Returns a state x such that `projection` of x, f(x), f(f(x)), ... gives `outputs`, where f is `affine`,
+// or `std::nullopt` if none is found. x is the state right after the step that produced `outputs[0]`.
+// The hidden low bits are found by lattice reduction, instead of trying each of their 2^shift values:
+// with z_i the hidden bits of the i-th state, z_i - a_i z_0 = d_i (mod m) for known a_i and d_i,
+// so (z_i) is a short vector of a translated lattice, found by LLL and Babai's nearest plane.
+// Enough outputs are needed for x to be unique: a few more than m's bits / `projection.bits()`.
+// Require: `projection` keep every bit of the state above `projection.shift()`, and m <= 2^64.
+// Time complexity: polynomial in `outputs.size()`.
+template <std::unsigned_integral UIntType>
+[[nodiscard]] constexpr auto recover_state(const LCGAffineTransform<UIntType>& affine, const LCGProjection<UIntType>& projection, std::span<const UIntType> outputs) -> std::optional<UIntType>
+{
+    constexpr int digits { std::numeric_limits<UIntType>::digits };
+    static_assert(digits <= 64, "the lattice uses __int128_t, so the modulus must not exceed 2^64");
+
+    const detail::UnsignedModder<UIntType>& modder { affine.modder() };
+    const __int128_t m { modder.m() == 0 ? __int128_t { 1 } << digits : __int128_t { modder.m() } };
+    const unsigned shift { projection.shift() };
+    assert(((m - 1) >> (shift + projection.bits())) == 0);
+
+    const auto matches {
+        [&affine, &projection, outputs](UIntType state) noexcept -> bool {
+            for (std::size_t i { 0 }; i != outputs.size(); ++i, state = affine(state)) {
+                if (projection(state) != outputs[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    if (outputs.empty()) {
+        return std::nullopt;
+    }
+    const auto high_bits {
+        [shift, outputs](std::size_t i) noexcept -> UIntType {
+            return static_cast<UIntType>(static_cast<UIntType>(outputs[i]) << shift);
+        }
+    };
+    if (shift == 0) {
+        return matches(outputs[0]) ? std::optional<UIntType> { outputs[0] } : std::nullopt;
+    }
+
+    // State i is f^i(x) = a_i x + c_i = high_i + z_i, with x = high_0 + z_0.
+    // So z_i - a_i z_0 = c_i + a_i high_0 - high_i = d_i (mod m).
+    const std::size_t k { outputs.size() };
+    std::vector<detail::LatticeVector> basis(k, detail::LatticeVector(k));
+    detail::LatticeVector offset(k);
+    LCGAffineTransform<UIntType> power { affine.identity() };
+    for (std::size_t i { 0 }; i != k; ++i, power = compose(affine, power)) {
+        basis[0][i] = power.a();
+        if (i != 0) {
+            basis[i][i] = m;
+        }
+        offset[i] = modder.minus_mod(modder.times_plus_mod(power.a(), high_bits(0), power.c()), high_bits(i));
+    }
+    // `offset` satisfies the congruences, and so does z; their difference is in the lattice spanned by `basis`:
+    // vectors v with v_i = a_i v_0 (mod m). Look for z near the center of the box [0, 2^shift)^k.
+    offset[0] = 0;
+    const __int128_t center { __int128_t { 1 } << (shift - 1) };
+    detail::LatticeVector target(k);
+    for (std::size_t i { 0 }; i != k; ++i) {
+        target[i] = center - offset[i];
+    }
+    const detail::LatticeVector closest { detail::babai_nearest_plane(detail::lll_reduce(std::move(basis)), target) };
+
+    const __int128_t z0 { offset[0] + closest[0] };
+    if (z0 < 0 || z0 >= (__int128_t { 1 } << shift) || high_bits(0) + z0 >= m) {
+        return std::nullopt;
+    }
+    const auto state { static_cast<UIntType>(high_bits(0) + z0) };
+    return matches(state) ? std::optional<UIntType> { state } : std::nullopt;
+}
+
+// Returns `like`, with its state recovered from `outputs`, so that its next `operator()` continues after them.
+// Require: the same as `recover_state`.
+template <std::unsigned_integral UIntType>
+[[nodiscard]] constexpr auto recover_engine(const ProjectedLCGEngine<UIntType>& like, std::span<const UIntType> outputs) -> std::optional<ProjectedLCGEngine<UIntType>>
+{
+    const std::optional<UIntType> first { recover_state(like.engine().affine(), like.projection(), outputs) };
+    if (!first.has_value()) {
+        return std::nullopt;
+    }
+    ProjectedLCGEngine<UIntType> result { like };
+    result.set_state(*first);
+    result.discard(outputs.size() - 1);
+    return result;
+}
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_RECOVERY_HPP_INCLUDED
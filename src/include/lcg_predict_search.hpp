@@ -0,0 +1,176 @@
+// 2026-10  lcg_predict_search.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_SEARCH_HPP_INCLUDED
+#define LCG_PREDICT_SEARCH_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+#include "lcg_predict_parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ls_hower::lcg_predict {
+
+// Brute-force search for the seeds that reproduce some observed outputs.
+// A seed s is a match if an engine with state s, after `offset` discarded steps, returns `observed` from
+// `operator()` through `projection`.
+// The state of the first observed output is g(s), where g = f^(offset + 1) is affine, so consecutive seeds
+// have states differing by the constant g.a(): candidates are stepped in lanes by additions alone, and
+// rejected on the first output before the others are checked.
+template <std::unsigned_integral UIntType>
+class SeedSearch {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    using projection_type = LCGProjection<UIntType>;
+    // Number of seeds tested together, as in `LCGEngine::generate`.
+    static constexpr std::size_t lanes { LCGEngine<UIntType>::generation_lanes };
+
+private:
+    affine_type affine_;
+    projection_type projection_;
+    std::vector<result_type> observed_;
+    // Maps a seed to the state of `observed_[0]`.
+    affine_type first_;
+
+    // Same as `matches(seed)`, with `state` the state of `observed_[0]`.
+    [[nodiscard]] constexpr auto state_matches(result_type state) const noexcept -> bool
+    {
+        for (const result_type output : observed_) {
+            if (projection_(state) != output) {
+                return false;
+            }
+            state = affine_(state);
+        }
+        return true;
+    }
+
+    // Reduces a seed modulo m. `affine_.modder()` only takes values up to twice as wide as `UIntType`, which
+    // `unsigned long long` is not for 8- and 16-bit `UIntType`.
+    [[nodiscard]] constexpr auto reduce_seed(unsigned long long seed) const noexcept -> result_type
+    {
+        const detail::UnsignedModder<UIntType>& modder { affine_.modder() };
+        if constexpr (sizeof(detail::least_doubled_uint_t<UIntType>) < sizeof(unsigned long long)) {
+            return static_cast<result_type>(seed % modder.template real_m<unsigned long long>());
+        } else {
+            return modder(seed);
+        }
+    }
+
+public:
+    // Require: `observed` be nonempty.
+    constexpr SeedSearch(affine_type affine, projection_type projection, std::vector<result_type> observed, unsigned long long offset = 0)
+        : affine_ { affine }
+        , projection_ { projection }
+        , observed_ { std::move(observed) }
+        , first_ { affine_.powered(offset + 1) }
+    {
+        assert(!observed_.empty());
+    }
+
+    [[nodiscard]] constexpr auto affine() const noexcept -> affine_type { return affine_; }
+    [[nodiscard]] constexpr auto projection() const noexcept -> projection_type { return projection_; }
+    [[nodiscard]] constexpr auto observed() const noexcept -> const std::vector<result_type>& { return observed_; }
+
+    [[nodiscard]] constexpr auto matches(unsigned long long seed) const noexcept -> bool
+    {
+        return this->state_matches(first_(this->reduce_seed(seed)));
+    }
+
+    // Calls `on_match(seed)` for each matching seed in [first, last), in increasing order.
+    template <std::invocable<unsigned long long> OnMatch>
+    constexpr auto scan(unsigned long long first, unsigned long long last, OnMatch&& on_match) const -> void
+    {
+        const detail::UnsignedModder<UIntType>& modder { affine_.modder() };
+        const result_type target { observed_.front() };
+        const result_type lane_stride { modder.times_mod(first_.a(), this->reduce_seed(lanes)) };
+
+        std::array<result_type, lanes> states {};
+        if (last - first >= lanes) {
+            for (std::size_t j { 0 }; j != lanes; ++j) {
+                states[j] = first_(this->reduce_seed(first + j));
+            }
+        }
+        for (/* void */; last - first >= lanes; first += lanes) {
+            std::array<bool, lanes> hits {};
+            bool any_hit { false };
+            if (modder.kind() == detail::ReductionKind::mask) {
+                // Wrapping arithmetic, which the compiler can vectorize, as in `LCGEngine::generate`.
+                using Work = std::common_type_t<UIntType, unsigned int>;
+                const Work mask { static_cast<UIntType>(modder.m() - 1U) };
+                for (std::size_t j { 0 }; j != lanes; ++j) {
+                    hits[j] = projection_(states[j]) == target;
+                    any_hit |= hits[j];
+                    states[j] = static_cast<result_type>((Work { states[j] } + lane_stride) & mask);
+                }
+            } else {
+                for (std::size_t j { 0 }; j != lanes; ++j) {
+                    hits[j] = projection_(states[j]) == target;
+                    any_hit |= hits[j];
+                    states[j] = modder.plus_mod(states[j], lane_stride);
+                }
+            }
+            if (any_hit) {
+                for (std::size_t j { 0 }; j != lanes; ++j) {
+                    if (hits[j] && this->matches(first + j)) {
+                        on_match(first + j);
+                    }
+                }
+            }
+        }
+        for (/* void */; first != last; ++first) {
+            if (this->matches(first)) {
+                on_match(first);
+            }
+        }
+    }
+
+    // Same as `scan`, but [first, last) is split into at most `thread_count` contiguous blocks of at least
+    // `min_block_size` seeds, scanned concurrently.
+    // `on_match` is called as matches are found, one call at a time, in no particular order.
+    // If a thread cannot be started, `std::system_error` is thrown.
+    template <std::invocable<unsigned long long> OnMatch>
+    auto parallel_scan(unsigned long long first, unsigned long long last, OnMatch&& on_match,
+        std::size_t thread_count = std::thread::hardware_concurrency(),
+        std::size_t min_block_size = parallel_min_block_size) const noexcept(false) -> void
+    {
+        const unsigned long long size { last - first };
+        const auto blocks { static_cast<std::size_t>(std::clamp<unsigned long long>(size / std::max<std::size_t>(min_block_size, 1), 1, std::max<std::size_t>(thread_count, 1))) };
+        if (blocks == 1) {
+            this->scan(first, last, on_match);
+            return;
+        }
+        std::mutex on_match_mutex {};
+        detail::run_blocks_concurrently(blocks, [this, first, size, blocks, &on_match, &on_match_mutex](std::size_t i) -> void {
+            this->scan(first + detail::block_begin(size, blocks, i), first + detail::block_begin(size, blocks, i + 1),
+                [&on_match, &on_match_mutex](unsigned long long seed) -> void {
+                    const std::scoped_lock lock { on_match_mutex };
+                    on_match(seed);
+                });
+        });
+    }
+
+    // Returns every matching seed in [first, last), in increasing order.
+    [[nodiscard]] auto find_all(unsigned long long first, unsigned long long last,
+        std::size_t thread_count = std::thread::hardware_concurrency(),
+        std::size_t min_block_size = parallel_min_block_size) const noexcept(false) -> std::vector<unsigned long long>
+    {
+        std::vector<unsigned long long> result {};
+        this->parallel_scan(first, last, [&result](unsigned long long seed) { result.push_back(seed); }, thread_count, min_block_size);
+        std::ranges::sort(result);
+        return result;
+    }
+};
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_SEARCH_HPP_INCLUDED
@@ -0,0 +1,184 @@
+// 2026-10  lcg_predict_segments.hpp
+
+#pragma once
+
+#ifndef LCG_PREDICT_SEGMENTS_HPP_INCLUDED
+#define LCG_PREDICT_SEGMENTS_HPP_INCLUDED
+
+#include "lcg_predict.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ls_hower::lcg_predict {
+
+// `count` steps of `affine`: a stretch of a generator whose (a, c) is changed at known checkpoints.
+template <detail::unsigned_integer_like UIntType>
+struct LCGSegment {
+    LCGAffineTransform<UIntType> affine;
+    unsigned long long count;
+
+    // Returns f^count, where f is `affine`.
+    // Time complexity: O(log(count)).
+    [[nodiscard]] constexpr auto transform() const noexcept -> LCGAffineTransform<UIntType>
+    {
+        return affine.powered(count);
+    }
+
+    [[nodiscard]] friend constexpr auto operator==(const LCGSegment& lhs, const LCGSegment& rhs) noexcept -> bool = default;
+};
+
+// Writes the transform of segments [0, i] to out[i] for every i, i.e. the map from the first state to the
+// state at the end of segment i.
+// Require: `segments.size() == out.size()`, and all the segments have the same m.
+// Time complexity: O(sum over i of log(segments[i].count)).
+template <detail::unsigned_integer_like UIntType>
+constexpr auto prefix_compositions(std::span<const LCGSegment<UIntType>> segments, std::span<LCGAffineTransform<UIntType>> out) noexcept -> void
+{
+    assert(segments.size() == out.size());
+    for (std::size_t i { 0 }; i != segments.size(); ++i) {
+        out[i] = i == 0 ? segments[i].transform() : compose(segments[i].transform(), out[i - 1]);
+    }
+}
+
+// A sequence of segments, each `count` steps of its own transform, with the composition of every range of them.
+// Segment i runs after segment i - 1. A binary tree over the segments stores, at each node, the composition of the
+// segments below it and their total number of steps. So the transform of any range of segments, or of the first
+// `steps` steps, takes O(log(size())) compositions instead of a pass over the segments, and changing one segment
+// recomputes only the O(log(size())) nodes above it.
+template <detail::unsigned_integer_like UIntType>
+class LCGSegmentTree {
+public:
+    using result_type = UIntType;
+    using affine_type = LCGAffineTransform<UIntType>;
+    using segment_type = LCGSegment<UIntType>;
+
+private:
+    struct Node {
+        affine_type transform;
+        unsigned long long steps;
+    };
+
+    std::vector<segment_type> segments_;
+    affine_type identity_;
+    // A power of two, at least `size()`. Leaf `leaves_ + i` is segment i, and leaves past the segments hold the
+    // identity. Node 1 is the root, and the children of node k are 2k and 2k + 1.
+    std::size_t leaves_;
+    std::vector<Node> nodes_;
+
+    constexpr auto set_leaf(std::size_t i) noexcept -> void
+    {
+        nodes_[leaves_ + i] = Node { segments_[i].transform(), segments_[i].count };
+    }
+
+    // The right child runs after the left child.
+    constexpr auto pull(std::size_t k) noexcept -> void
+    {
+        const Node& left { nodes_[2 * k] };
+        const Node& right { nodes_[(2 * k) + 1] };
+        assert(left.steps <= std::numeric_limits<unsigned long long>::max() - right.steps);
+        nodes_[k] = Node { compose(right.transform, left.transform), left.steps + right.steps };
+    }
+
+public:
+    // Require: `!segments.empty()`, all the segments have the same m, and the total count fits in `unsigned long long`.
+    // Time complexity: O(size() + sum over i of log(segments[i].count)).
+    explicit constexpr LCGSegmentTree(std::vector<segment_type> segments)
+        : segments_ { std::move(segments) }
+        , identity_ { segments_.front().affine.identity() }
+        , leaves_ { std::bit_ceil(segments_.size()) }
+        , nodes_(2 * leaves_, Node { identity_, 0 })
+    {
+        for (std::size_t i { 0 }; i != segments_.size(); ++i) {
+            this->set_leaf(i);
+        }
+        for (std::size_t k { leaves_ - 1 }; k != 0; --k) {
+            this->pull(k);
+        }
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return segments_.size(); }
+    [[nodiscard]] constexpr auto segments() const noexcept -> std::span<const segment_type> { return segments_; }
+    [[nodiscard]] constexpr auto segment(std::size_t i) const noexcept -> const segment_type& { return segments_[i]; }
+    [[nodiscard]] constexpr auto total_steps() const noexcept -> unsigned long long { return nodes_[1].steps; }
+
+    // Replaces segment i.
+    // Require: `i < size()`, and `segment` has the same m as the others.
+    // Time complexity: O(log(size()) + log(segment.count)).
+    constexpr auto set(std::size_t i, const segment_type& segment) noexcept -> void
+    {
+        assert(i < segments_.size());
+        segments_[i] = segment;
+        this->set_leaf(i);
+        for (std::size_t k { (leaves_ + i) / 2 }; k != 0; k /= 2) {
+            this->pull(k);
+        }
+    }
+
+    // Returns the transform of all the segments.
+    [[nodiscard]] constexpr auto composed() const noexcept -> affine_type
+    {
+        return nodes_[1].transform;
+    }
+
+    // Returns the transform of segments [first, last): segment `first` first.
+    // Require: `first <= last && last <= size()`.
+    // Time complexity: O(log(size())).
+    [[nodiscard]] constexpr auto composed(std::size_t first, std::size_t last) const noexcept -> affine_type
+    {
+        assert(first <= last && last <= segments_.size());
+        // Nodes are taken from both ends towards the middle: those of the left end run before everything taken so
+        // far on the left, and those of the right end after everything taken so far on the right.
+        affine_type left { identity_ };
+        affine_type right { identity_ };
+        for (std::size_t l { leaves_ + first }, r { leaves_ + last }; l < r; l /= 2, r /= 2) {
+            if (l % 2 == 1) {
+                left = compose(nodes_[l++].transform, left);
+            }
+            if (r % 2 == 1) {
+                right = compose(right, nodes_[--r].transform);
+            }
+        }
+        return compose(right, left);
+    }
+
+    // Returns the transform of the first `steps` steps, across segments.
+    // Require: `steps <= total_steps()`.
+    // Time complexity: O(log(size()) + log(count of the segment where the steps end)).
+    [[nodiscard]] constexpr auto prefix(unsigned long long steps) const noexcept -> affine_type
+    {
+        assert(steps <= this->total_steps());
+        affine_type result { identity_ };
+        std::size_t k { 1 };
+        while (k < leaves_) {
+            const Node& left { nodes_[2 * k] };
+            if (steps < left.steps) {
+                k = 2 * k;
+            } else {
+                steps -= left.steps;
+                result = compose(left.transform, result);
+                k = (2 * k) + 1;
+            }
+        }
+        if (steps != 0) {
+            result = compose(segments_[k - leaves_].affine.powered(steps), result);
+        }
+        return result;
+    }
+
+    // Returns the state `steps` steps after the state `x` at the start of segment 0.
+    // Require: `steps <= total_steps()`.
+    [[nodiscard]] constexpr auto value_after_n_steps(result_type x, unsigned long long steps) const noexcept -> result_type
+    {
+        return this->prefix(steps)(x);
+    }
+};
+
+} // namespace ls_hower::lcg_predict
+
+#endif // LCG_PREDICT_SEGMENTS_HPP_INCLUDED
@@ -0,0 +1,195 @@
+// 2026-10  lcg_predict_fingerprint_test.cpp
+
+#include "../include/lcg_predict_fingerprint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Most of this test is evaluated at compile time. `main` writes an index to a file and maps it back, which cannot
+// be done in constant evaluation.
+// Usage: lcg_predict_fingerprint_test
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// The first `count` outputs of `source` after skipping `offset`.
+template <std::size_t count>
+[[nodiscard]] constexpr auto outputs_at(const FingerprintSource& source, unsigned long long offset) noexcept -> std::array<std::uint64_t, count>
+{
+    std::array<std::uint64_t, count> outputs {};
+    std::uint64_t state { source.affine.powered(offset)(source.affine.modder()(source.seed)) };
+    for (std::uint64_t& output : outputs) {
+        state = source.affine(state);
+        output = source.projection(state);
+    }
+    return outputs;
+}
+
+// Looks up 3 outputs of each source at `offset` in an index of `sources`.
+[[nodiscard]] constexpr auto finds_sources(std::span<const FingerprintSource> sources, unsigned long long offset) -> bool
+{
+    const std::vector<std::uint64_t> words { build_fingerprint_index(sources, 16, 8) };
+    const FingerprintIndexView index { words };
+    for (std::size_t i { 0 }; i != sources.size(); ++i) {
+        if (index.source(i) != FingerprintSource { sources[i].affine, sources[i].projection, sources[i].affine.modder()(sources[i].seed) }) {
+            return false;
+        }
+        const std::vector<FingerprintMatch> matches { index.find(outputs_at<3>(sources[i], offset)) };
+        if (matches != std::vector<FingerprintMatch> { FingerprintMatch { i, offset } }) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every preset, at the first and last offsets of the index, and between giant steps.
+static_assert(finds_sources(fingerprint_presets, 0));
+static_assert(finds_sources(fingerprint_presets, 17));
+static_assert(finds_sources(fingerprint_presets, 127));
+
+// A seed set: the same generators, so one giant-step walk each, over every seed.
+[[nodiscard]] constexpr auto finds_seed(std::size_t preset, std::uint64_t seed, unsigned long long offset) -> bool
+{
+    constexpr std::array<std::uint64_t, 3> seeds { 1, 42, 12345 };
+    const std::vector<FingerprintSource> sources { preset_fingerprint_sources(seeds) };
+    const std::vector<std::uint64_t> words { build_fingerprint_index(sources, 16, 8) };
+    const std::size_t source { (preset * seeds.size()) + static_cast<std::size_t>(std::ranges::find(seeds, seed) - seeds.begin()) };
+    return FingerprintIndexView { words }.find(outputs_at<3>(sources[source], offset)) == std::vector<FingerprintMatch> { FingerprintMatch { source, offset } };
+}
+
+static_assert(finds_seed(0, 42, 100));
+static_assert(finds_seed(4, 12345, 5));
+static_assert(finds_seed(6, 1, 127));
+
+// Offsets past `max_offset()` are not found.
+static_assert(FingerprintIndexView { build_fingerprint_index(fingerprint_presets, 16, 8) }.find(outputs_at<3>(fingerprint_presets[0], 128)).empty());
+
+// m == 0 of an 8-bit engine is 256, and its period is shorter than the baby steps: the first offset is found.
+constexpr inline FingerprintSource short_period { FingerprintSource::from(ProjectedLCGEngine<std::uint8_t> { LCGEngine<std::uint8_t> { 37, 7, 0, 42 }, LCGProjection<std::uint8_t>::identity() }) };
+static_assert(short_period.affine.m() == 256 && short_period.projection.bits() == 8 && short_period.seed == 42);
+static_assert(FingerprintIndexView { build_fingerprint_index(std::span<const FingerprintSource> { &short_period, 1 }, 1000, 1) }.find(outputs_at<3>(short_period, 300)) == std::vector<FingerprintMatch> { FingerprintMatch { 0, 300 - 256 } });
+
+// Headers that are not those of an index.
+static_assert(detail::fingerprint_index_words(build_fingerprint_index(fingerprint_presets, 16, 8)) == build_fingerprint_index(fingerprint_presets, 16, 8).size());
+static_assert(detail::fingerprint_index_words(std::vector<std::uint64_t> { detail::fingerprint_magic, detail::fingerprint_version }) == 0);
+static_assert(detail::fingerprint_index_words(std::vector<std::uint64_t> { detail::fingerprint_magic + 1, detail::fingerprint_version, 0, 0, 1, 1, 1, 0 }) == 0);
+
+// Generators and sources that would be read out of bounds, or shift by 64 bits or more.
+[[nodiscard]] constexpr auto records_valid_with(std::size_t word, std::uint64_t value) -> bool
+{
+    std::vector<std::uint64_t> words { build_fingerprint_index(fingerprint_presets, 16, 8) };
+    words[word] = value;
+    return detail::fingerprint_records_valid(words);
+}
+
+constexpr inline std::size_t first_generator { detail::fingerprint_header_words };
+constexpr inline std::size_t first_source { first_generator + (detail::fingerprint_generator_words * fingerprint_presets.size()) };
+static_assert(detail::fingerprint_records_valid(build_fingerprint_index(fingerprint_presets, 16, 8)));
+static_assert(records_valid_with(first_source, fingerprint_presets.size() - 1));
+static_assert(!records_valid_with(first_source, fingerprint_presets.size()));
+static_assert(!records_valid_with(first_generator + 3, 64));
+static_assert(!records_valid_with(first_generator + 3, 1ULL << 32));
+static_assert(!records_valid_with(first_generator + 4, 0));
+static_assert(!records_valid_with(first_generator + 4, 65));
+// krc_rand keeps bits 16 to 30 of states modulo 2^31: bits 0 to 15 would drop bits above them.
+static_assert(fingerprint_presets[0].projection == LCGProjection<std::uint64_t> { 16, 15 });
+static_assert(!records_valid_with(first_generator + 4, 14));
+
+// The view of a mapped index points into the memory it owns, so it moves but does not copy.
+static_assert(!std::is_copy_constructible_v<MappedFingerprintIndex> && !std::is_copy_assignable_v<MappedFingerprintIndex>);
+static_assert(std::is_nothrow_move_constructible_v<MappedFingerprintIndex> && std::is_nothrow_move_assignable_v<MappedFingerprintIndex>);
+
+bool failed { false };
+
+auto check(bool passed, const char* what) -> void
+{
+    if (!passed) {
+        std::printf("FAILED: %s\n", what);
+        failed = true;
+    }
+}
+
+// Writes `words` to `path`, less `dropped_bytes` at the end.
+[[nodiscard]] auto write_bytes(const std::filesystem::path& path, std::span<const std::uint64_t> words, std::size_t dropped_bytes) -> bool
+{
+    std::ofstream file { path, std::ios::binary | std::ios::trunc };
+    file.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size_bytes() - dropped_bytes)); // NOLINT : bytes of the words, as `write_fingerprint_index` writes them.
+    return static_cast<bool>(file.flush());
+}
+
+// An index written by `write_fingerprint_index` and mapped back finds what the index in memory finds.
+auto check_round_trip(const std::filesystem::path& path) -> void
+{
+    const std::vector<std::uint64_t> words { build_fingerprint_index(fingerprint_presets, 16, 8) };
+    check(write_fingerprint_index(path, words), "write an index");
+    const std::optional<MappedFingerprintIndex> index { MappedFingerprintIndex::open(path) };
+    check(index.has_value(), "open a written index");
+    if (!index.has_value()) {
+        return;
+    }
+    check(std::ranges::equal(index->view().words(), words), "the words of a mapped index");
+    for (std::size_t i { 0 }; i != fingerprint_presets.size(); ++i) {
+        for (const unsigned long long offset : { 0ULL, 17ULL, 127ULL }) {
+            const std::vector<FingerprintMatch> matches { index->find(outputs_at<3>(fingerprint_presets[i], offset)) };
+            check(matches == std::vector<FingerprintMatch> { FingerprintMatch { i, offset } }, fingerprint_preset_names[i].data());
+        }
+    }
+    check(index->find(outputs_at<3>(fingerprint_presets[0], 128)).empty(), "an offset past max_offset() of a mapped index");
+
+    // A move keeps the mapping.
+    std::optional<MappedFingerprintIndex> opened { MappedFingerprintIndex::open(path) };
+    if (!opened.has_value()) {
+        return;
+    }
+    const MappedFingerprintIndex moved { std::move(*opened) };
+    check(moved.find(outputs_at<3>(fingerprint_presets[6], 5)) == std::vector<FingerprintMatch> { FingerprintMatch { 6, 5 } }, "a moved index");
+}
+
+// Files that are not indices, or whose records would be read out of bounds, are not opened.
+auto check_rejected(const std::filesystem::path& path) -> void
+{
+    std::filesystem::remove(path);
+    check(!MappedFingerprintIndex::open(path).has_value(), "a missing file");
+
+    std::vector<std::uint64_t> words { build_fingerprint_index(fingerprint_presets, 16, 8) };
+    check(write_bytes(path, words, sizeof(std::uint64_t)) && !MappedFingerprintIndex::open(path).has_value(), "a file truncated by a word");
+    check(write_bytes(path, words, 1) && !MappedFingerprintIndex::open(path).has_value(), "a file truncated by a byte");
+    check(write_bytes(path, {}, 0) && !MappedFingerprintIndex::open(path).has_value(), "an empty file");
+
+    const auto rejects_with {
+        [&path, &words](std::size_t word, std::uint64_t value) -> bool {
+            const std::uint64_t original { words[word] };
+            words[word] = value;
+            const bool written { write_fingerprint_index(path, words) };
+            words[word] = original;
+            return written && !MappedFingerprintIndex::open(path).has_value();
+        }
+    };
+    check(rejects_with(0, detail::fingerprint_magic + 1), "a bad magic number");
+    check(rejects_with(1, detail::fingerprint_version + 1), "a bad version");
+    check(rejects_with(first_source, fingerprint_presets.size()), "a bad generator of a source");
+    check(rejects_with(first_generator + 3, 64), "a bad shift");
+    check(rejects_with(first_generator + 4, 0), "bad bits");
+}
+
+}
+
+auto main() -> int
+{
+    const std::filesystem::path path { std::filesystem::temp_directory_path() / "lcg_predict_fingerprint_test.index" };
+    check_round_trip(path);
+    check_rejected(path);
+    std::filesystem::remove(path);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,344 @@
+// 2026-10  lcg_predict_fuzz_test.cpp
+
+#include "../include/lcg_predict.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Unlike the other tests, which check fixed parameters at compile time, this one runs: it draws random (a, c, m,
+// seed, n) for every width, including m == 0 and m == 1, on several threads until a time budget runs out.
+// Usage: lcg_predict_fuzz_test [seconds] [threads] [seed]
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+using detail::UnsignedDoubledLongLong;
+
+template <typename T>
+constexpr inline int digits_of { static_cast<int>(sizeof(T) * CHAR_BIT) };
+
+// Reference: (a, c) modulo the real m, with a plain widening `%`, for T up to 64 bits.
+struct ReferenceAffine {
+    __uint128_t a;
+    __uint128_t c;
+};
+
+template <typename T>
+[[nodiscard]] constexpr auto real_modulus(T m) noexcept -> __uint128_t
+{
+    return m != 0 ? __uint128_t { m } : __uint128_t { 1 } << digits_of<T>;
+}
+
+// Returns f such that f(x) = lhs(rhs(x)). Every value is below 2^64, so a * c + c fits in 128 bits.
+[[nodiscard]] constexpr auto reference_compose(ReferenceAffine lhs, ReferenceAffine rhs, __uint128_t m) noexcept -> ReferenceAffine
+{
+    return { (lhs.a * rhs.a) % m, ((lhs.a * rhs.c) + lhs.c) % m };
+}
+
+// Right-to-left binary powering, unlike the left-to-right `detail::double_and_add`.
+[[nodiscard]] constexpr auto reference_powered(ReferenceAffine base, unsigned long long n, __uint128_t m) noexcept -> ReferenceAffine
+{
+    ReferenceAffine result { 1 % m, 0 };
+    for (; n != 0; n >>= 1U) {
+        if ((n & 1U) != 0) {
+            result = reference_compose(base, result, m);
+        }
+        base = reference_compose(base, base, m);
+    }
+    return result;
+}
+
+template <typename T>
+[[nodiscard]] auto random_bits(std::mt19937_64& rng) -> T
+{
+    if constexpr (digits_of<T> <= 64) {
+        return static_cast<T>(rng());
+    } else {
+        const __uint128_t high { rng() };
+        return static_cast<T>((high << 64U) | rng());
+    }
+}
+
+// Moduli of every reduction strategy: 0 and powers of two for masks, 2^k - 1 for Mersenne reduction, and small,
+// near-maximal and arbitrary ones for Barrett reduction, plus 1.
+template <typename T>
+[[nodiscard]] auto random_modulus(std::mt19937_64& rng) -> T
+{
+    const auto shift { static_cast<unsigned>(rng() % digits_of<T>) };
+    const auto max { static_cast<T>(~T { 0 }) };
+    const T spread { max < 1000U ? max : static_cast<T>(1000) };
+    switch (rng() % 8) {
+    case 0:
+        return 0;
+    case 1:
+        return 1;
+    case 2:
+        return static_cast<T>(T { 1 } << shift);
+    case 3:
+        return static_cast<T>(max >> shift);
+    case 4:
+        return static_cast<T>(max - static_cast<T>(rng() % spread));
+    case 5:
+        return static_cast<T>(2 + (rng() % 1000));
+    default:
+        return random_bits<T>(rng);
+    }
+}
+
+// Mostly arbitrary coefficients, with the edge cases 0, 1 and m - 1 now and then.
+template <typename T>
+[[nodiscard]] auto random_coefficient(std::mt19937_64& rng, T m) -> T
+{
+    switch (rng() % 8) {
+    case 0:
+        return 0;
+    case 1:
+        return 1;
+    case 2:
+        return static_cast<T>(m - 1);
+    default:
+        return random_bits<T>(rng);
+    }
+}
+
+// Step counts of every bit length, small ones that stepping can check, and the maximum.
+[[nodiscard]] auto random_steps(std::mt19937_64& rng) -> unsigned long long
+{
+    switch (rng() % 8) {
+    case 0:
+        return rng() % 300;
+    case 1:
+        return std::numeric_limits<unsigned long long>::max();
+    default:
+        return rng() >> (rng() % 64);
+    }
+}
+
+template <typename T>
+struct Parameters {
+    T a;
+    T c;
+    T m;
+    T seed;
+    T other_a;
+    T other_c;
+    unsigned long long n;
+};
+
+template <typename T>
+[[nodiscard]] auto random_parameters(std::mt19937_64& rng) -> Parameters<T>
+{
+    const T m { random_modulus<T>(rng) };
+    return {
+        random_coefficient<T>(rng, m),
+        random_coefficient<T>(rng, m),
+        m,
+        random_bits<T>(rng),
+        random_coefficient<T>(rng, m),
+        random_coefficient<T>(rng, m),
+        random_steps(rng),
+    };
+}
+
+// Returns the name of the first check that fails, if any.
+template <std::unsigned_integral T>
+[[nodiscard]] auto narrow_failure(const Parameters<T>& p) -> std::optional<std::string_view>
+{
+    const __uint128_t m { real_modulus(p.m) };
+    const ReferenceAffine f_reference { p.a % m, p.c % m };
+    const ReferenceAffine powered_reference { reference_powered(f_reference, p.n, m) };
+    const __uint128_t seed { p.seed % m };
+    const auto expected { static_cast<T>(((powered_reference.a * seed) + powered_reference.c) % m) };
+
+    const LCGAffineTransform<T> f { p.a, p.c, p.m };
+    if (const LCGAffineTransform<T> powered { f.powered(p.n) };
+        powered.a() != static_cast<T>(powered_reference.a) || powered.c() != static_cast<T>(powered_reference.c)) {
+        return "powered";
+    }
+    const LCGEngine<T> engine { f, p.seed };
+    if (engine.value_after_n_steps(p.n) != expected) {
+        return "value_after_n_steps";
+    }
+    if (const ReferenceAffine composed { reference_compose(f_reference, { p.other_a % m, p.other_c % m }, m) };
+        compose(f, LCGAffineTransform<T> { p.other_a, p.other_c, p.m }) != LCGAffineTransform<T> { static_cast<T>(composed.a), static_cast<T>(composed.c), p.m }) {
+        return "compose";
+    }
+    LCGEngine<T> discarded { engine };
+    discarded.discard(p.n);
+    if (discarded.state() != expected) {
+        return "discard";
+    }
+    LCGEngine<T> stepped { engine };
+    __uint128_t x { seed };
+    for (unsigned long long i { 0 }; i != p.n % 64; ++i) {
+        x = ((f_reference.a * x) + f_reference.c) % m;
+        if (stepped() != static_cast<T>(x)) {
+            return "operator()";
+        }
+    }
+    return std::nullopt;
+}
+
+[[nodiscard]] auto to_doubled(__uint128_t value) noexcept -> UnsignedDoubledLongLong
+{
+    return UnsignedDoubledLongLong::from_words(static_cast<unsigned long long>(value >> 64U), static_cast<unsigned long long>(value));
+}
+
+// 128-bit states have no wider native type for a reference, so `__uint128_t` and `UnsignedDoubledLongLong`, which
+// reduce differently, check each other, and the results are checked against stepping and composing powers.
+[[nodiscard]] auto wide_failure(const Parameters<__uint128_t>& p) -> std::optional<std::string_view>
+{
+    const LCGAffineTransform<__uint128_t> f { p.a, p.c, p.m };
+    const LCGAffineTransform<UnsignedDoubledLongLong> doubled_f { to_doubled(p.a), to_doubled(p.c), to_doubled(p.m) };
+    const LCGAffineTransform<__uint128_t> powered { f.powered(p.n) };
+    if (const LCGAffineTransform<UnsignedDoubledLongLong> doubled_powered { doubled_f.powered(p.n) };
+        to_doubled(powered.a()) != doubled_powered.a() || to_doubled(powered.c()) != doubled_powered.c()) {
+        return "powered";
+    }
+    if (const unsigned long long half { p.n / 2 }; compose(f.powered(half), f.powered(p.n - half)) != powered) {
+        return "powered (sum of counts)";
+    }
+    const LCGEngine<__uint128_t> engine { f, p.seed };
+    const __uint128_t expected { engine.value_after_n_steps(p.n) };
+    if (expected != powered(engine.state())
+        || to_doubled(expected) != LCGEngine<UnsignedDoubledLongLong> { doubled_f, to_doubled(p.seed) }.value_after_n_steps(p.n)) {
+        return "value_after_n_steps";
+    }
+    const LCGAffineTransform<__uint128_t> g { p.other_a, p.other_c, p.m };
+    if (const LCGAffineTransform<__uint128_t> composed { compose(f, g) };
+        composed(engine.state()) != f(g(engine.state()))
+        || to_doubled(composed.a()) != compose(doubled_f, LCGAffineTransform<UnsignedDoubledLongLong> { to_doubled(p.other_a), to_doubled(p.other_c), to_doubled(p.m) }).a()) {
+        return "compose";
+    }
+    LCGEngine<__uint128_t> discarded { engine };
+    discarded.discard(p.n);
+    if (discarded.state() != expected) {
+        return "discard";
+    }
+    LCGEngine<__uint128_t> stepped { engine };
+    for (unsigned long long i { 0 }; i != p.n % 64; ++i) {
+        if (stepped() != engine.value_after_n_steps(i + 1)) {
+            return "operator()";
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename T>
+[[nodiscard]] auto failure(const Parameters<T>& p) -> std::optional<std::string_view>
+{
+    if constexpr (digits_of<T> <= 64) {
+        return narrow_failure(p);
+    } else {
+        return wide_failure(p);
+    }
+}
+
+template <typename T>
+[[nodiscard]] auto to_hex(T value) -> std::string
+{
+    std::array<char, 40> buffer {};
+    if constexpr (digits_of<T> <= 64) {
+        std::snprintf(buffer.data(), buffer.size(), "0x%0*llx", digits_of<T> / 4, static_cast<unsigned long long>(value));
+    } else {
+        std::snprintf(buffer.data(), buffer.size(), "0x%016llx%016llx", static_cast<unsigned long long>(value >> 64U), static_cast<unsigned long long>(value));
+    }
+    return buffer.data();
+}
+
+template <typename T>
+[[nodiscard]] auto describe(std::string_view check, const Parameters<T>& p) -> std::string
+{
+    return std::string { check } + " failed for " + std::to_string(digits_of<T>) + "-bit a = " + to_hex(p.a) + ", c = " + to_hex(p.c)
+        + ", m = " + to_hex(p.m) + ", seed = " + to_hex(p.seed) + ", other a = " + to_hex(p.other_a) + ", other c = " + to_hex(p.other_c)
+        + ", n = " + std::to_string(p.n);
+}
+
+constexpr inline std::array<std::string_view, 5> width_names { "uint8_t", "uint16_t", "uint32_t", "uint64_t", "uint128" };
+
+struct Shared {
+    std::chrono::steady_clock::time_point deadline;
+    std::array<std::atomic<unsigned long long>, width_names.size()> verified {};
+    std::atomic<bool> failed { false };
+    std::mutex failure_mutex {};
+    std::string failure {};
+};
+
+// Checks one parameter set of width `index`, and records the first failure.
+template <typename T>
+auto fuzz_one(std::mt19937_64& rng, Shared& shared, std::size_t index) -> void
+{
+    const Parameters<T> p { random_parameters<T>(rng) };
+    if (const std::optional<std::string_view> check { failure(p) }; check.has_value()) {
+        const std::lock_guard<std::mutex> lock { shared.failure_mutex };
+        if (!shared.failed.exchange(true)) {
+            shared.failure = describe(*check, p);
+        }
+        return;
+    }
+    shared.verified[index].fetch_add(1, std::memory_order_relaxed);
+}
+
+auto fuzz(std::uint64_t seed, Shared& shared) -> void
+{
+    std::mt19937_64 rng { seed };
+    while (!shared.failed.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < shared.deadline) {
+        for (int i { 0 }; i != 16; ++i) {
+            fuzz_one<std::uint8_t>(rng, shared, 0);
+            fuzz_one<std::uint16_t>(rng, shared, 1);
+            fuzz_one<std::uint32_t>(rng, shared, 2);
+            fuzz_one<std::uint64_t>(rng, shared, 3);
+            fuzz_one<__uint128_t>(rng, shared, 4);
+        }
+    }
+}
+
+}
+
+auto main(int argc, char** argv) -> int
+{
+    const double seconds { argc > 1 ? std::strtod(argv[1], nullptr) : 2.0 }; // NOLINT : argv is a C array.
+    const unsigned threads { argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : std::max(std::thread::hardware_concurrency(), 1U) }; // NOLINT : argv is a C array.
+    const std::uint64_t seed { argc > 3 ? std::strtoull(argv[3], nullptr, 10) : std::random_device {}() }; // NOLINT : argv is a C array.
+    std::printf("# seed %llu, %u threads, %.1f s\n", static_cast<unsigned long long>(seed), threads, seconds);
+
+    Shared shared {};
+    const auto start { std::chrono::steady_clock::now() };
+    shared.deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double> { seconds });
+    std::vector<std::thread> workers {};
+    for (unsigned i { 0 }; i != threads; ++i) {
+        workers.emplace_back([seed, i, &shared] { fuzz(seed + i, shared); });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double elapsed { std::chrono::duration<double> { std::chrono::steady_clock::now() - start }.count() };
+
+    unsigned long long total { 0 };
+    for (std::size_t i { 0 }; i != width_names.size(); ++i) {
+        const unsigned long long verified { shared.verified[i].load() };
+        total += verified;
+        std::printf("%-10.*s %12llu parameter sets\n", static_cast<int>(width_names[i].size()), width_names[i].data(), verified);
+    }
+    std::printf("%llu parameter sets in %.2f s: %.0f per second\n", total, elapsed, static_cast<double>(total) / elapsed);
+    if (shared.failed) {
+        std::printf("%s\n", shared.failure.c_str());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
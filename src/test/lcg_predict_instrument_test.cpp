@@ -0,0 +1,142 @@
+// 2026-10  lcg_predict_instrument_test.cpp
+
+#define LCG_PREDICT_INSTRUMENT
+#include "../include/lcg_predict.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Like the fuzz test, this one runs: the counters are per-thread state, which does not exist at compile time.
+// Usage: lcg_predict_instrument_test
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+static_assert(counters_enabled);
+
+// Constant evaluation still works, and counts nothing.
+static_assert(musl_rand_engine.value_after_n_steps(1000) == musl_rand_engine.affine().powered(1000)(musl_rand_engine.state()));
+
+bool failed { false };
+
+auto check(bool passed, const char* what) -> void
+{
+    if (!passed) {
+        std::printf("FAILED: %s\n", what);
+        failed = true;
+    }
+}
+
+// One bucket of a histogram, as a difference of two snapshots.
+[[nodiscard]] auto distances(std::size_t bits, std::uint64_t count) -> std::array<std::uint64_t, detail::distance_buckets>
+{
+    std::array<std::uint64_t, detail::distance_buckets> buckets {};
+    buckets[bits] = count;
+    return buckets;
+}
+
+// powered(n) composes once per bit of n to square, and once per set bit to multiply, each composition with one
+// times_mod and one times_plus_mod. Applying the power is one more times_plus_mod.
+auto check_jump() -> void
+{
+    constexpr unsigned long long n { 1000 };
+    constexpr auto compositions { static_cast<std::uint64_t>(std::bit_width(n) + std::popcount(n)) };
+    LCGEngine<std::uint_fast64_t> engine { musl_rand_engine };
+    const LCGCounters before { thread_counters() };
+    engine.discard(n);
+    const LCGCounters counted { thread_counters() - before };
+
+    check(counted.times_mod == std::array<std::uint64_t, 3> { compositions, 0, 0 }, "times_mod of a jump modulo 2^64");
+    check(counted.times_plus_mod == std::array<std::uint64_t, 3> { compositions + 1, 0, 0 }, "times_plus_mod of a jump modulo 2^64");
+    check(counted.compose_assign == compositions, "compose_assign of a jump");
+    check(counted.double_and_add_calls == 1 && counted.double_and_add_iterations == std::bit_width(n), "double_and_add of a jump");
+    check(counted.powered_distances == distances(10, 1), "powered distance of a jump");
+    check(counted.jump_distances == distances(10, 1), "jump distance");
+    check(counted.engine_steps == 0 && counted.backward_jumps == 0 && counted.table_jumps == 0, "other counters of a jump");
+}
+
+auto check_steps() -> void
+{
+    LCGEngine<std::uint_fast32_t> engine { minstd_rand_engine };
+    std::vector<std::uint_fast32_t> values(1000);
+    const LCGCounters before { thread_counters() };
+    (void)engine();
+    engine.generate(values);
+    const LCGCounters counted { thread_counters() - before };
+
+    check(counted.engine_steps == 1 + values.size(), "engine steps, one at a time and in bulk");
+    // 2^31 - 1 is a Mersenne number. As m is not a power of two, `apply_each` steps each bulk value with `times_plus_mod`.
+    check(counted.times_plus_mod[1] >= 1 + values.size() && counted.times_plus_mod[0] == 0 && counted.times_plus_mod[2] == 0, "steps modulo 2^31 - 1 are Mersenne folds");
+}
+
+auto check_backward_and_table() -> void
+{
+    LCGEngine<std::uint_fast64_t> engine { posix_rand48_engine };
+    const std::array<unsigned long long, 3> indices { 5, 70000, 3 };
+    std::array<std::uint_fast64_t, 3> out {};
+    const LCGCounters before { thread_counters() };
+    engine.discard(-5);
+    engine.discard(1ULL << 40U, posix_rand48_static_engine.jump_table());
+    engine.values_at(indices, out, posix_rand48_static_engine.jump_table());
+    const LCGCounters counted { thread_counters() - before };
+
+    std::array<std::uint64_t, detail::distance_buckets> jumps {};
+    // 5 back, 2^40, then 5, 70000 - 5, and 3 again from the state.
+    jumps[2] = 1;
+    jumps[3] = 2;
+    jumps[17] = 1;
+    jumps[41] = 1;
+    check(counted.jump_distances == jumps, "jump distances");
+    check(counted.backward_jumps == 1, "backward jumps");
+    check(counted.table_jumps == 4, "table jumps");
+    check(counted.powered_distances == distances(3, 1), "only the backward jump is powered");
+}
+
+auto check_wide() -> void
+{
+    const LCGEngine<detail::UnsignedDoubledLongLong> engine { detail::UnsignedDoubledLongLong { 5 }, detail::UnsignedDoubledLongLong { 1 } };
+    const LCGCounters before { thread_counters() };
+    (void)engine.value_after_n_steps(detail::UnsignedDoubledLongLong::from_words(1, 0));
+    const LCGCounters counted { thread_counters() - before };
+
+    check(counted.jump_distances == distances(65, 1), "a jump of 2^64 steps");
+    check(counted.double_and_add_iterations == 65, "double_and_add of a 2^64-step jump");
+}
+
+// Threads count separately, and the counters of those that exited stay in the sum.
+auto check_threads() -> void
+{
+    const LCGCounters before_all { all_counters() };
+    const LCGCounters before { thread_counters() };
+    std::thread worker { [] {
+        LCGEngine<std::uint_fast64_t> engine { musl_rand_engine };
+        for (int i { 0 }; i != 100; ++i) {
+            (void)engine();
+        }
+    } };
+    worker.join();
+
+    check(thread_counters() == before, "another thread's counters");
+    const LCGCounters counted { all_counters() - before_all };
+    check(counted.engine_steps == 100 && counted.times_plus_mod[0] == 100, "the counters of an exited thread");
+}
+
+}
+
+auto main() -> int
+{
+    check_jump();
+    check_steps();
+    check_backward_and_table();
+    check_wide();
+    check_threads();
+    std::cout << all_counters();
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
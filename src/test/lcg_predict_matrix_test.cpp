@@ -0,0 +1,111 @@
+// 2026-10  lcg_predict_matrix_test.cpp
+
+#include "../include/lcg_predict_matrix.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+template <std::size_t step, typename Engine>
+[[nodiscard]] constexpr auto get_simulation(Engine engine) noexcept -> std::array<typename Engine::result_type, step>
+{
+    std::array<typename Engine::result_type, step> simulation {};
+    for (typename Engine::result_type& value : simulation) {
+        value = engine();
+    }
+    return simulation;
+}
+
+// Checks jumps to some of the first `step` values, bulk generation and block splitting against calling `operator()`.
+template <std::size_t step, typename Engine>
+[[nodiscard]] constexpr auto jump_simulation_same(const Engine& engine) noexcept -> bool
+{
+    const auto simulation { get_simulation<step>(engine) };
+    for (const std::size_t i : { std::size_t { 0 }, std::size_t { 1 }, std::size_t { 2 }, step / 2, step - 1 }) {
+        if (engine.value_after_n_steps(i + 1) != simulation[i]) {
+            return false;
+        }
+    }
+    Engine generating { engine };
+    std::array<typename Engine::result_type, step> generated {};
+    generating.generate(generated);
+    Engine discarded { engine };
+    discarded.discard(step);
+    constexpr unsigned long long block_len { step / 4 };
+    Engine block { engine.split_block(4, 3, block_len) };
+    return generated == simulation
+        && generating == discarded
+        && block() == simulation[3 * block_len];
+}
+
+// With K == 1, a `MatrixLCGTransform` is an `LCGAffineTransform`.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto scalar_affine_same(T a, T c, T m, unsigned long long n) noexcept -> bool
+{
+    const MatrixLCGTransform<T, 1> matrix { { { { a } } }, { c }, m };
+    const LCGAffineTransform<T> affine { a, c, m };
+    const MatrixLCGTransform<T, 1> powered { matrix.powered(n) };
+    return powered.a()[0][0] == affine.powered(n).a() && powered.c()[0] == affine.powered(n).c();
+}
+
+static_assert(scalar_affine_same<std::uint32_t>(1103515245, 12345, 0, 12345678));
+static_assert(scalar_affine_same<std::uint64_t>(48271, 0, 2147483647, 1000000007));
+static_assert(scalar_affine_same<std::uint64_t>(6364136223846793005U, 1442695040888963407U, 0, 0xffff'ffff'ffffULL));
+static_assert(scalar_affine_same<std::uint64_t>(3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 987654321));
+
+// A 2 x 2 affine transform with c != 0, modulo a prime and modulo 2^32.
+static_assert(jump_simulation_same<100>(MatrixLCGEngine<std::uint32_t, 2> { MatrixLCGTransform<std::uint32_t, 2> { { { { 3, 5 }, { 7, 11 } } }, { 13, 17 }, 65521 }, { 1, 2 } }));
+static_assert(jump_simulation_same<100>(MatrixLCGEngine<std::uint32_t, 2> { MatrixLCGTransform<std::uint32_t, 2> { { { { 3, 5 }, { 7, 11 } } }, { 13, 17 }, 0 }, { 1, 2 } }));
+// Not lazy: 3 products of 64-bit residues overflow 128 bits.
+static_assert(jump_simulation_same<100>(MatrixLCGEngine<std::uint64_t, 3> { MatrixLCGTransform<std::uint64_t, 3>::multiple_recursive({ 3935559000370003845U, 2, 2691343689449507681U }, 18446744073709551557U), { 1, 2, 3 } }));
+
+// Computed by the reference implementation in L'Ecuyer (1999); 545508589 / 4294967088 = 0.1270111220...
+constexpr inline std::array<std::uint_fast64_t, 5> mrg32k3a_actual { 545508589, 1368065410, 1327943761, 3546985096, 951893194 };
+static_assert(get_simulation<5>(mrg32k3a_engine) == mrg32k3a_actual);
+static_assert(mrg32k3a_engine.value_after_n_steps(10000) == 878310219);
+static_assert(jump_simulation_same<100>(mrg32k3a_engine));
+static_assert(jump_simulation_same<100>(mrg32k3a_engine.engines()[0]));
+
+// Computed by the algorithm in L'Ecuyer (1988).
+constexpr inline std::array<std::uint_fast64_t, 5> lecuyer1988_actual { 2139113652, 953804932, 403745442, 2020452502, 172033125 };
+static_assert(get_simulation<5>(lecuyer1988_engine) == lecuyer1988_actual);
+static_assert(lecuyer1988_engine.value_after_n_steps(10000) == 2022312435);
+static_assert(jump_simulation_same<100>(lecuyer1988_engine));
+
+// Equal values of the components combine to 0, which is returned as the modulus.
+static_assert(CombinedLCGEngine<LCGEngine<std::uint32_t>, 2> { { LCGEngine<std::uint32_t> { 5, 1, 101, 7 }, LCGEngine<std::uint32_t> { 5, 1, 101, 7 } }, 100 }() == 100);
+
+// Checks the combination of three components against (x_1 - x_2 + x_3) mod `modulus`, with the components'
+// values below 2 * modulus and above.
+[[nodiscard]] constexpr auto combination_same(std::uint32_t modulus) noexcept -> bool
+{
+    std::array<LCGEngine<std::uint32_t>, 3> components {
+        LCGEngine<std::uint32_t> { 5, 1, 101, 7 },
+        LCGEngine<std::uint32_t> { 17, 3, 97, 8 },
+        LCGEngine<std::uint32_t> { 3, 0, 103, 9 },
+    };
+    CombinedLCGEngine<LCGEngine<std::uint32_t>, 3> combined { components, modulus };
+    for (int i { 0 }; i != 100; ++i) {
+        const long long z { (static_cast<long long>(components[0]()) - components[1]() + components[2]()) % modulus };
+        const long long expected { z > 0 ? z : z < 0 ? z + modulus : modulus };
+        if (combined() != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(combination_same(100));
+static_assert(combination_same(7));
+
+}
+
+auto main() -> int
+{
+}
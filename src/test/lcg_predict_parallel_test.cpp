@@ -0,0 +1,116 @@
+// 2026-10  lcg_predict_parallel_test.cpp
+
+#include "../include/lcg_predict_parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_serial_same(const LCGEngine<T>& engine, std::size_t thread_count, std::size_t min_block_size) -> bool
+{
+    LCGEngine<T> parallel { engine };
+    LCGEngine<T> serial { engine };
+    std::array<T, step> parallel_values {};
+    std::array<T, step> serial_values {};
+    parallel_generate<T>(parallel, parallel_values, thread_count, min_block_size);
+    serial.generate(serial_values);
+    return parallel_values == serial_values && parallel == serial;
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_serial_same(const LCGEngine<T>& engine) -> bool
+{
+    return parallel_serial_same<0>(engine, 4, 1)
+        && parallel_serial_same<3>(engine, 4, 1)
+        && parallel_serial_same<100>(engine, 1, 1)
+        && parallel_serial_same<100>(engine, 3, 1)
+        && parallel_serial_same<1000>(engine, 7, 1)
+        && parallel_serial_same<1000>(engine, 8, 200)
+        && parallel_serial_same<1000>(engine, 0, 0);
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_values_at_same(const LCGEngine<T>& engine, std::size_t thread_count, std::size_t min_block_size) -> bool
+{
+    constexpr std::array<unsigned long long, 9> indices { 12345, 0, 7, 100, 7, 0xffff'ffff'ffff'ffffULL, 1, 0x8000'0000'0000'3039ULL, 8 };
+    std::array<T, indices.size()> parallel_values {};
+    std::array<T, indices.size()> serial_values {};
+    parallel_values_at<T>(engine, indices, parallel_values, thread_count, min_block_size);
+    engine.values_at(indices, serial_values);
+    // `std::uint64_t` is `unsigned long` on LP64 platforms, not `unsigned long long`.
+    const std::vector<std::uint64_t> wide_indices(indices.begin(), indices.end());
+    std::array<T, indices.size()> wide_values {};
+    parallel_values_at<T>(engine, wide_indices, wide_values, thread_count, min_block_size);
+    return parallel_values == serial_values && wide_values == serial_values;
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_values_at_same(const LCGEngine<T>& engine) -> bool
+{
+    return parallel_values_at_same(engine, 1, 1)
+        && parallel_values_at_same(engine, 4, 1)
+        && parallel_values_at_same(engine, 4, 3)
+        && parallel_values_at_same(engine, 20, 1)
+        && parallel_values_at_same(engine, 0, 0);
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_prefix_compositions_same(T m, std::size_t size, std::size_t thread_count, std::size_t min_block_size) -> bool
+{
+    std::vector<LCGSegment<T>> segments {};
+    for (std::size_t i { 0 }; i != size; ++i) {
+        segments.push_back(LCGSegment<T> { LCGAffineTransform<T> { static_cast<T>((i * 7919) + 5), static_cast<T>(i + 1), m }, (i * 5) % 7 });
+    }
+    const LCGAffineTransform<T> filler { 1, 0, m };
+    std::vector<LCGAffineTransform<T>> parallel_prefixes(size, filler);
+    std::vector<LCGAffineTransform<T>> serial_prefixes(size, filler);
+    parallel_prefix_compositions<T>(segments, parallel_prefixes, thread_count, min_block_size);
+    prefix_compositions<T>(segments, serial_prefixes);
+    return parallel_prefixes == serial_prefixes;
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto parallel_prefix_compositions_same(T m) -> bool
+{
+    return parallel_prefix_compositions_same(m, 0, 4, 1)
+        && parallel_prefix_compositions_same(m, 1, 4, 1)
+        && parallel_prefix_compositions_same(m, 100, 1, 1)
+        && parallel_prefix_compositions_same(m, 100, 3, 1)
+        && parallel_prefix_compositions_same(m, 100, 7, 10)
+        && parallel_prefix_compositions_same(m, 100, 200, 1)
+        && parallel_prefix_compositions_same(m, 100, 0, 0);
+}
+
+static_assert(detail::block_begin(10, 3, 0) == 0);
+static_assert(detail::block_begin(10, 3, 1) == 4);
+static_assert(detail::block_begin(10, 3, 2) == 7);
+static_assert(detail::block_begin(10, 3, 3) == 10);
+
+static_assert(parallel_serial_same(krc_rand_engine));
+static_assert(parallel_serial_same(minstd_rand_engine));
+static_assert(parallel_serial_same(minstd_rand0_engine));
+static_assert(parallel_serial_same(msvc_rand_engine));
+static_assert(parallel_serial_same(posix_rand48_engine));
+static_assert(parallel_serial_same(musl_rand_engine));
+static_assert(parallel_serial_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+
+static_assert(parallel_values_at_same(minstd_rand_engine));
+static_assert(parallel_values_at_same(musl_rand_engine));
+static_assert(parallel_values_at_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+
+static_assert(parallel_prefix_compositions_same<std::uint32_t>(0));
+static_assert(parallel_prefix_compositions_same<std::uint16_t>(65521));
+
+}
+
+auto main() -> int
+{
+}
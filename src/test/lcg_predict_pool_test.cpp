@@ -0,0 +1,108 @@
+// 2026-10  lcg_predict_pool_test.cpp
+
+#include "../include/lcg_predict_pool.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// Checks each operation of a pool of `count` engines against `count` separate `LCGEngine`s.
+template <std::size_t count, std::unsigned_integral T>
+[[nodiscard]] constexpr auto pool_separate_same(const LCGEngine<T>& engine) -> bool
+{
+    std::vector<T> seeds(count);
+    std::vector<LCGEngine<T>> separate {};
+    for (std::size_t i { 0 }; i != count; ++i) {
+        seeds[i] = engine.value_after_n_steps(i * 7919);
+        separate.emplace_back(engine.affine(), seeds[i]);
+    }
+    LCGEnginePool<T> pool { engine.affine(), seeds };
+    const auto same {
+        [&pool, &separate]() -> bool {
+            for (std::size_t i { 0 }; i != count; ++i) {
+                if (pool.state(i) != separate[i].state() || pool.engine(i) != separate[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    for (int round { 0 }; round != 3; ++round) {
+        pool.step_all();
+        for (LCGEngine<T>& e : separate) {
+            (void)e();
+        }
+    }
+    if (!same()) {
+        return false;
+    }
+
+    std::array<bool, count> selected {};
+    for (std::size_t i { 0 }; i != count; ++i) {
+        selected[i] = i % 3 != 1;
+    }
+    pool.step_selected(selected);
+    for (std::size_t i { 0 }; i != count; ++i) {
+        if (selected[i]) {
+            (void)separate[i]();
+        }
+    }
+    if (!same()) {
+        return false;
+    }
+
+    pool.discard_all(123456789);
+    for (LCGEngine<T>& e : separate) {
+        e.discard(123456789);
+    }
+    if (!same()) {
+        return false;
+    }
+
+    std::array<unsigned long long, count> n {};
+    for (std::size_t i { 0 }; i != count; ++i) {
+        n[i] = (i * i * 1000003) ^ (i << 40);
+    }
+    pool.discard_each(n);
+    for (std::size_t i { 0 }; i != count; ++i) {
+        separate[i].discard(n[i]);
+    }
+    return same();
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto pool_separate_same(const LCGEngine<T>& engine) -> bool
+{
+    return pool_separate_same<1>(engine)
+        && pool_separate_same<5>(engine)
+        && pool_separate_same<37>(engine);
+}
+
+static_assert(pool_separate_same(krc_rand_engine));
+static_assert(pool_separate_same(minstd_rand_engine));
+static_assert(pool_separate_same(minstd_rand0_engine));
+static_assert(pool_separate_same(msvc_rand_engine));
+static_assert(pool_separate_same(posix_rand48_engine));
+static_assert(pool_separate_same(musl_rand_engine));
+static_assert(pool_separate_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+static_assert(pool_separate_same(LCGEngine<std::uint8_t> { 5, 3, 0, 7 }));
+
+static_assert([] {
+    LCGEnginePool<std::uint_fast32_t> pool { minstd_rand_engine.affine(), 3, 0 };
+    pool.push_back(2147483647U + 5);
+    pool.set_state(1, 42);
+    return pool.size() == 4 && pool.state(0) == 0 && pool.state(1) == 42 && pool.state(3) == 5;
+}());
+
+}
+
+auto main() -> int
+{
+}
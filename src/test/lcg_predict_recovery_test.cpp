@@ -0,0 +1,58 @@
+// 2026-10  lcg_predict_recovery_test.cpp
+
+#include "../include/lcg_predict_recovery.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// Observes `count` outputs of `engine` seeded with `seed`, recovers the engine from them, and predicts the next 100 outputs.
+template <std::size_t count, std::unsigned_integral T>
+[[nodiscard]] constexpr auto recovery_prediction_same(ProjectedLCGEngine<T> engine, T seed) -> bool
+{
+    engine.set_state(seed);
+    std::array<T, count> outputs {};
+    for (T& output : outputs) {
+        output = engine();
+    }
+    std::optional<ProjectedLCGEngine<T>> recovered { recover_engine(engine, std::span<const T> { outputs }) };
+    if (!recovered.has_value()) {
+        return false;
+    }
+    for (std::size_t i { 0 }; i != 100; ++i) {
+        if ((*recovered)() != engine()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(recovery_prediction_same<6>(krc_rand_output_engine, std::uint_fast32_t { 123456789 }));
+static_assert(recovery_prediction_same<6>(msvc_rand_output_engine, std::uint_fast32_t { 987654321 }));
+static_assert(recovery_prediction_same<1>(minstd_rand_output_engine, std::uint_fast32_t { 42 }));
+static_assert(recovery_prediction_same<1>(minstd_rand0_output_engine, std::uint_fast32_t { 42 }));
+static_assert(recovery_prediction_same<6>(posix_lrand48_output_engine, std::uint_fast64_t { 0x1234ABCD330E }));
+static_assert(recovery_prediction_same<6>(posix_mrand48_output_engine, std::uint_fast64_t { 0x1234ABCD330E }));
+static_assert(recovery_prediction_same<6>(musl_rand_output_engine, std::uint_fast64_t { 0xDEADBEEFCAFEF00D }));
+// A prime modulus, with the 30 low bits of 60 hidden.
+static_assert(recovery_prediction_same<6>(
+    ProjectedLCGEngine<std::uint64_t> {
+        LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U },
+        LCGProjection<std::uint64_t> { 30, 30 } },
+    std::uint64_t { 42 }));
+
+// Outputs that no state produces.
+static_assert(!recover_state(msvc_rand_engine.affine(), msvc_rand_projection, std::span<const std::uint_fast32_t> { std::array<std::uint_fast32_t, 6> { 1, 2, 3, 4, 5, 6 } }).has_value());
+
+}
+
+auto main() -> int
+{
+}
@@ -0,0 +1,55 @@
+// 2026-10  lcg_predict_search_test.cpp
+
+#include "../include/lcg_predict_search.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// Observes `count` outputs of `engine` seeded with `seed` after `offset` steps, and searches for the seed
+// among [first, last) both lane by lane and one seed at a time.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto search_finds_seed(ProjectedLCGEngine<T> engine, unsigned long long seed, unsigned long long offset,
+    std::size_t count, unsigned long long first, unsigned long long last) -> bool
+{
+    engine.set_state(static_cast<T>(seed));
+    engine.discard(offset);
+    std::vector<T> observed(count);
+    for (T& output : observed) {
+        output = engine();
+    }
+    const SeedSearch<T> search { engine.engine().affine(), engine.projection(), observed, offset };
+
+    std::vector<unsigned long long> scanned {};
+    search.scan(first, last, [&scanned](unsigned long long s) { scanned.push_back(s); });
+    std::vector<unsigned long long> checked {};
+    for (unsigned long long s { first }; s != last; ++s) {
+        if (search.matches(s)) {
+            checked.push_back(s);
+        }
+    }
+    return scanned == checked && scanned == std::vector<unsigned long long> { seed };
+}
+
+static_assert(search_finds_seed(krc_rand_output_engine, 12345, 0, 3, 10000, 20003));
+static_assert(search_finds_seed(msvc_rand_output_engine, 1700000000, 5, 3, 1699995001, 1700004000));
+static_assert(search_finds_seed(minstd_rand_output_engine, 777, 1000, 1, 1, 3000));
+static_assert(search_finds_seed(posix_lrand48_output_engine, 0x1234ABCD330E, 0, 2, 0x1234ABCD0000, 0x1234ABCD4007));
+static_assert(search_finds_seed(musl_rand_output_engine, 31337, 100, 2, 30000, 35000));
+// Ranges shorter than the lanes.
+static_assert(search_finds_seed(krc_rand_output_engine, 3, 0, 3, 0, 5));
+// Seeds wider than 8- and 16-bit states, modulo a prime and modulo 2^16 and 2^8.
+static_assert(search_finds_seed(ProjectedLCGEngine<std::uint16_t> { LCGEngine<std::uint16_t> { 17364, 1, 65521 }, LCGProjection<std::uint16_t> { 8, 8 } }, 12345, 3, 3, 10000, 20003));
+static_assert(search_finds_seed(ProjectedLCGEngine<std::uint16_t> { LCGEngine<std::uint16_t> { 25173, 13849, 0 }, LCGProjection<std::uint16_t> { 8, 8 } }, 61234, 0, 3, 60000, 65536));
+static_assert(search_finds_seed(ProjectedLCGEngine<std::uint8_t> { LCGEngine<std::uint8_t> { 37, 7, 0 }, LCGProjection<std::uint8_t> { 4, 4 } }, 200, 1, 6, 0, 256));
+
+}
+
+auto main() -> int
+{
+}
@@ -0,0 +1,112 @@
+// 2026-10  lcg_predict_segments_test.cpp
+
+#include "../include/lcg_predict_segments.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace ls_hower::lcg_predict;
+
+// Segments of a few steps each, with a different (a, c) in each, and some without any step.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto make_segments(T m, std::size_t size) -> std::vector<LCGSegment<T>>
+{
+    std::vector<LCGSegment<T>> segments {};
+    for (std::size_t i { 0 }; i != size; ++i) {
+        const LCGAffineTransform<T> affine { static_cast<T>((i * 7919) + 5), static_cast<T>((i * 104729) + 1), m };
+        segments.push_back(LCGSegment<T> { affine, (i * 5) % 7 });
+    }
+    return segments;
+}
+
+// Replays the segments one step at a time, as an engine whose transform is replaced at every checkpoint.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto replay(const std::vector<LCGSegment<T>>& segments, T seed) -> std::vector<T>
+{
+    std::vector<T> states { seed };
+    LCGEngine<T> engine { segments.front().affine, seed };
+    for (const LCGSegment<T>& segment : segments) {
+        engine.set_affine(segment.affine);
+        for (unsigned long long i { 0 }; i != segment.count; ++i) {
+            states.push_back(engine());
+        }
+    }
+    return states;
+}
+
+// Folds the segments [first, last) one composition at a time.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto fold(const std::vector<LCGSegment<T>>& segments, std::size_t first, std::size_t last) -> LCGAffineTransform<T>
+{
+    LCGAffineTransform<T> result { segments.front().affine.identity() };
+    for (std::size_t i { first }; i != last; ++i) {
+        result = compose(segments[i].transform(), result);
+    }
+    return result;
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto tree_replay_same(const LCGSegmentTree<T>& tree, const std::vector<LCGSegment<T>>& segments, T seed) -> bool
+{
+    const std::vector<T> states { replay(segments, seed) };
+    if (tree.total_steps() + 1 != states.size() || tree.composed() != fold(segments, 0, segments.size())) {
+        return false;
+    }
+    for (unsigned long long steps { 0 }; steps != states.size(); ++steps) {
+        if (tree.value_after_n_steps(seed, steps) != states[steps]) {
+            return false;
+        }
+    }
+    for (std::size_t first { 0 }; first <= segments.size(); ++first) {
+        for (std::size_t last { first }; last <= segments.size(); ++last) {
+            if (tree.composed(first, last) != fold(segments, first, last)) {
+                return false;
+            }
+        }
+    }
+    std::vector<LCGAffineTransform<T>> prefixes(segments.size(), segments.front().affine);
+    prefix_compositions<T>(segments, prefixes);
+    for (std::size_t i { 0 }; i != segments.size(); ++i) {
+        if (prefixes[i] != fold(segments, 0, i + 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Checks a tree of `size` segments against replaying them, before and after replacing some of them.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto segment_tree_same(T m, std::size_t size) -> bool
+{
+    constexpr T seed { 42 };
+    std::vector<LCGSegment<T>> segments { make_segments(m, size) };
+    LCGSegmentTree<T> tree { segments };
+    if (!tree_replay_same(tree, segments, seed)) {
+        return false;
+    }
+    for (std::size_t i { 0 }; i < size; i += 2) {
+        segments[i] = LCGSegment<T> { LCGAffineTransform<T> { static_cast<T>(i + 3), 11, m }, i + 2 };
+        tree.set(i, segments[i]);
+    }
+    return tree.segments().size() == size && tree.segment(0) == segments[0] && tree_replay_same(tree, segments, seed);
+}
+
+static_assert(segment_tree_same<std::uint32_t>(0, 1));
+static_assert(segment_tree_same<std::uint32_t>(0, 2));
+static_assert(segment_tree_same<std::uint32_t>(0, 7));
+static_assert(segment_tree_same<std::uint32_t>(0, 16));
+static_assert(segment_tree_same<std::uint16_t>(65521, 13));
+static_assert(segment_tree_same<std::uint64_t>(2147483647, 9));
+
+// One segment of many steps: the prefix ends inside it, and is computed with `powered`.
+static_assert(LCGSegmentTree<std::uint_fast32_t> { { { minstd_rand_engine.affine(), 20000 } } }.value_after_n_steps(1, 10000) == minstd_rand_engine.value_after_n_steps(10000));
+
+}
+
+auto main() -> int
+{
+}
@@ -6,15 +6,20 @@
 #include <array>
 #include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <vector>
 
 namespace {
 
 using namespace ls_hower::lcg_predict;
 
-template <unsigned long long step, std::unsigned_integral T>
+template <std::size_t step, std::unsigned_integral T>
 [[nodiscard]] constexpr auto get_prediction(const LCGEngine<T>& engine) noexcept -> std::array<T, step>
 {
     const auto prediction_vw {
@@ -30,7 +35,7 @@ template <unsigned long long step, std::unsigned_integral T>
     return prediction;
 }
 
-template <unsigned long long step, std::unsigned_integral T>
+template <std::size_t step, std::unsigned_integral T>
 [[nodiscard]] constexpr auto get_simulation(const LCGEngine<T>& engine) noexcept -> std::array<T, step>
 {
     std::array<T, step> simulation {};
@@ -38,24 +43,656 @@ template <unsigned long long step, std::unsigned_integral T>
     return simulation;
 }
 
-template <unsigned long long step, std::unsigned_integral T>
+template <std::size_t step, std::unsigned_integral T>
 [[nodiscard]] constexpr auto prediction_actual_same(const LCGEngine<T>& engine, const std::array<T, step>& actual) noexcept -> bool
 {
     return std::ranges::equal(get_prediction<step, T>(engine), actual);
 }
 
-template <unsigned long long step, std::unsigned_integral T>
+template <std::size_t step, std::unsigned_integral T>
 [[nodiscard]] constexpr auto simulation_actual_same(const LCGEngine<T>& engine, const std::array<T, step>& actual) noexcept -> bool
 {
     return std::ranges::equal(get_simulation<step, T>(engine), actual);
 }
 
-template <unsigned long long step, std::unsigned_integral T>
+template <std::size_t step, std::unsigned_integral T>
 [[nodiscard]] constexpr auto prediction_simulation_same(const LCGEngine<T>& engine) noexcept -> bool
 {
     return std::ranges::equal(get_prediction<step, T>(engine), get_simulation<step, T>(engine));
 }
 
+template <unsigned window_bits, std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto jump_table_prediction_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    const LCGJumpTable<T, window_bits> table { engine.affine() };
+    const auto same_at {
+        [&engine, &table](unsigned long long n) noexcept -> bool {
+            return engine.value_after_n_steps(n, table) == engine.value_after_n_steps(n)
+                && table.powered(n) == engine.affine().powered(n);
+        }
+    };
+    return std::ranges::all_of(std::views::iota(0ULL, static_cast<unsigned long long>(step)), same_at)
+        && same_at(std::numeric_limits<unsigned long long>::max())
+        && same_at(0x8000'0000'0000'3039ULL)
+        && same_at(0x0123'4567'89ab'cdefULL);
+}
+
+template <std::size_t step, std::unsigned_integral T, T a, T c, T m>
+[[nodiscard]] constexpr auto static_dynamic_same(StaticLCGEngine<T, a, c, m> static_engine, const LCGEngine<T>& engine) noexcept -> bool
+{
+    const auto same_at {
+        [&static_engine, &engine](unsigned long long n) noexcept -> bool {
+            return static_engine.value_after_n_steps(n) == engine.value_after_n_steps(n);
+        }
+    };
+    return static_engine.affine() == engine.affine()
+        && static_engine.to_dynamic() == engine
+        && std::ranges::equal(get_simulation<step, T>(engine), get_simulation<step, T>(static_engine.to_dynamic()))
+        && std::ranges::equal(get_simulation<step, T>(engine), [&static_engine]() {
+               std::array<T, step> simulation {};
+               std::ranges::generate(simulation, static_engine);
+               return simulation;
+           }())
+        && same_at(0)
+        && same_at(15)
+        && same_at(16)
+        && same_at(10000)
+        && same_at(std::numeric_limits<unsigned long long>::max())
+        && same_at(0x0123'4567'89ab'cdefULL)
+        && same_at(0xf0f0'f0f0'f0f0'f0f0ULL);
+}
+
+// Checks a preset's compile-time table: its entries are the powers f^(digit * 16^i), and jumps through it, which the
+// preset itself takes, agree with jumps without it, also once the preset's parameters change.
+template <std::unsigned_integral T, T a, T c, T m>
+[[nodiscard]] constexpr auto preset_jump_table_same(const PresetLCGEngine<T, a, c, m>& preset) noexcept -> bool
+{
+    const LCGEngine<T> engine { preset.to_dynamic() };
+    const LCGJumpTable<T, 4>& table { StaticLCGEngine<T, a, c, m>::jump_table() };
+    const auto same_at {
+        [&preset, &engine, &table](unsigned long long n) noexcept -> bool {
+            return engine.value_after_n_steps(n, table) == engine.value_after_n_steps(n)
+                && preset.value_after_n_steps(n) == engine.value_after_n_steps(n)
+                && preset.value_before_n_steps(n) == engine.value_before_n_steps(n)
+                && table.powered(n) == engine.affine().powered(n);
+        }
+    };
+    for (std::size_t i { 0 }; i != 16; ++i) {
+        for (unsigned digit { 1 }; digit < 16; digit += 7) {
+            if (table.power(i, digit) != engine.affine().powered(static_cast<unsigned long long>(digit) << (4 * i))) {
+                return false;
+            }
+        }
+    }
+
+    PresetLCGEngine<T, a, c, m> rewound { preset };
+    LCGEngine<T> engine_rewound { engine };
+    rewound.discard(-12345);
+    engine_rewound.discard(-12345);
+    const std::array<unsigned long long, 3> indices { 10000, 1, 0x0123'4567'89ab'cdefULL };
+    std::array<T, indices.size()> values {};
+    std::array<T, indices.size()> engine_values {};
+    preset.values_at(indices, values);
+    engine.values_at(indices, engine_values);
+    PresetLCGEngine<T, a, c, m> changed { preset };
+    changed.set_c(c + 2);
+    return same_at(0)
+        && same_at(1)
+        && same_at(10000)
+        && same_at(std::numeric_limits<unsigned long long>::max())
+        && rewound == engine_rewound && values == engine_values
+        && changed.value_after_n_steps(10000) == changed.to_dynamic().value_after_n_steps(10000);
+}
+
+// Reference: stepping with a plain widening `%`, without `UnsignedModder`.
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto get_reference_simulation(T a, T c, T m, T seed) noexcept -> std::array<T, step>
+{
+    const __uint128_t real_m { m != 0 ? __uint128_t { m } : __uint128_t { std::numeric_limits<T>::max() } + 1 };
+    __uint128_t x { seed % real_m };
+    std::array<T, step> simulation {};
+    for (T& value : simulation) {
+        x = (((a % real_m) * x) + (c % real_m)) % real_m;
+        value = static_cast<T>(x);
+    }
+    return simulation;
+}
+
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto reduction_reference_same(detail::ReductionKind kind, T a, T c, T m, T seed) noexcept -> bool
+{
+    const LCGEngine<T> engine { a, c, m, seed };
+    return detail::UnsignedModder<T> { m }.kind() == kind
+        && std::ranges::equal(get_simulation<step, T>(engine), get_reference_simulation<step, T>(a, c, m, seed))
+        && prediction_simulation_same<step, T>(engine);
+}
+
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::mask, 6364136223846793005U, 1442695040888963407U, 0, 42));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::mask, 3, 5, 1, 42));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::mersenne, 437799614237992725U, 7, 2305843009213693951U, 42));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::mersenne, 18446744073709551557U, 3, 18446744073709551615U, 42));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::mersenne, 2, 1, 3, 2));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::barrett, 3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 42));
+static_assert(reduction_reference_same<100, std::uint64_t>(detail::ReductionKind::barrett, 9223372036854787000U, 9223372036854787001U, 9223372036854788000U, 9223372036854787999U));
+static_assert(reduction_reference_same<100, std::uint32_t>(detail::ReductionKind::barrett, 1588635695, 12345, 4294967291U, 42));
+static_assert(reduction_reference_same<100, std::uint32_t>(detail::ReductionKind::mersenne, 1588635695, 12345, 4294967295U, 42));
+static_assert(reduction_reference_same<100, std::uint16_t>(detail::ReductionKind::barrett, 17364, 1, 65521, 42));
+static_assert(reduction_reference_same<100, std::uint8_t>(detail::ReductionKind::barrett, 33, 7, 251, 42));
+static_assert(reduction_reference_same<100, std::uint8_t>(detail::ReductionKind::mask, 37, 7, 0, 42));
+
+// Checks the operations of `UnsignedDoubledLongLong` and `DoubledLongLong` against `__uint128_t` and `__int128_t`.
+// The operators use `__uint128_t` here, so the word-level algorithms used without it are checked directly.
+[[nodiscard]] constexpr auto doubled_native_same(__uint128_t x, __uint128_t y) noexcept -> bool
+{
+    using detail::DoubledLongLong;
+    using detail::UnsignedDoubledLongLong;
+    const auto make {
+        [](__uint128_t value) noexcept -> UnsignedDoubledLongLong {
+            return UnsignedDoubledLongLong::from_words(static_cast<unsigned long long>(value >> 64U), static_cast<unsigned long long>(value));
+        }
+    };
+    const auto same {
+        [&make](UnsignedDoubledLongLong value, __uint128_t expected) noexcept -> bool {
+            return value == make(expected);
+        }
+    };
+    const UnsignedDoubledLongLong dx { make(x) };
+    const UnsignedDoubledLongLong dy { make(y) };
+    const auto sx { static_cast<__int128_t>(x) };
+    const auto sy { static_cast<__int128_t>(y) };
+    const DoubledLongLong sdx { dx };
+    const DoubledLongLong sdy { dy };
+    const auto [quotient, remainder] { UnsignedDoubledLongLong::words_divide(dx, dy) };
+    return same(dx + dy, x + y) && same(dx - dy, x - y) && same(dx * dy, x * y)
+        && same(dx / dy, x / y) && same(dx % dy, x % y)
+        && same(dx << 37U, x << 37U) && same(dx >> 71U, x >> 71U)
+        && same(UnsignedDoubledLongLong::words_plus(dx, dy), x + y) && same(UnsignedDoubledLongLong::words_minus(dx, dy), x - y)
+        && same(UnsignedDoubledLongLong::words_times(dx, dy), x * y)
+        && same(quotient, x / y) && same(remainder, x % y)
+        && same(UnsignedDoubledLongLong::words_shifted_left(dx, 0U), x) && same(UnsignedDoubledLongLong::words_shifted_left(dx, 37U), x << 37U)
+        && same(UnsignedDoubledLongLong::words_shifted_left(dx, 64U), x << 64U) && same(UnsignedDoubledLongLong::words_shifted_left(dx, 127U), x << 127U)
+        && same(UnsignedDoubledLongLong::words_shifted_right(dx, 0U), x) && same(UnsignedDoubledLongLong::words_shifted_right(dx, 37U), x >> 37U)
+        && same(UnsignedDoubledLongLong::words_shifted_right(dx, 64U), x >> 64U) && same(UnsignedDoubledLongLong::words_shifted_right(dx, 127U), x >> 127U)
+        && same(detail::schoolbook_multiply_words(dx.low(), dy.low()), static_cast<__uint128_t>(dx.low()) * dy.low())
+        && same(detail::schoolbook_multiply_words(dx.high(), dy.high()), static_cast<__uint128_t>(dx.high()) * dy.high())
+        && (dx < dy) == (x < y)
+        && static_cast<UnsignedDoubledLongLong>(sdx / sdy) == make(static_cast<__uint128_t>(sx / sy))
+        && static_cast<UnsignedDoubledLongLong>(sdx % sdy) == make(static_cast<__uint128_t>(sx % sy))
+        && (sdx < sdy) == (sx < sy);
+}
+
+constexpr __uint128_t high_bit { __uint128_t { 1 } << 127U };
+static_assert(doubled_native_same(12345, 678));
+static_assert(doubled_native_same(~__uint128_t { 0 }, 3));
+static_assert(doubled_native_same(~__uint128_t { 0 }, 0xffff'ffff'ffff'fffbULL));
+static_assert(doubled_native_same((__uint128_t { 0x0123'4567'89ab'cdefULL } << 64U) | 0xfedc'ba98'7654'3210ULL, 0x8000'0000'0000'0001ULL));
+static_assert(doubled_native_same((__uint128_t { 0x0123'4567'89ab'cdefULL } << 64U) | 0xfedc'ba98'7654'3210ULL, (__uint128_t { 0x1234 } << 64U) | 5));
+static_assert(doubled_native_same(high_bit | 99, (__uint128_t { 0xffff'ffff'ffff'ffffULL } << 64U) | 0xffff'ffff'ffff'fff0ULL));
+static_assert(doubled_native_same(high_bit - 7, high_bit + 12));
+static_assert(detail::divide_words(0x7fff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'ffffULL, 0x8000'0000'0000'0000ULL).quotient == 0xffff'ffff'ffff'ffffULL);
+static_assert(detail::divide_words(0x7fff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'ffffULL, 0x8000'0000'0000'0000ULL).remainder == 0x7fff'ffff'ffff'ffffULL);
+
+// Checks `long_divide_words` against `__uint128_t`, including the corrections of each estimated 32-bit digit.
+[[nodiscard]] constexpr auto divide_words_same(unsigned long long high, unsigned long long low, unsigned long long d) noexcept -> bool
+{
+    const __uint128_t dividend { (static_cast<__uint128_t>(high) << 64U) | low };
+    const auto [quotient, remainder] { detail::long_divide_words(high, low, d) };
+    const auto [native_quotient, native_remainder] { detail::divide_words(high, low, d) };
+    return quotient == dividend / d && remainder == dividend % d && native_quotient == quotient && native_remainder == remainder;
+}
+
+static_assert(divide_words_same(0x7fff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'ffffULL, 0x8000'0000'0000'0000ULL));
+static_assert(divide_words_same(0, 12345, 678));
+static_assert(divide_words_same(2, 0, 3));
+static_assert(divide_words_same(0xffff'ffff'ffff'fffaULL, 0xffff'ffff'ffff'ffffULL, 0xffff'ffff'ffff'fffbULL));
+static_assert(divide_words_same(0x8000'0000'0000'0000ULL, 0, 0x8000'0000'0000'0001ULL));
+static_assert(divide_words_same(0x0000'0001'0000'0000ULL, 0x0000'0000'ffff'ffffULL, 0x0000'0001'0000'0001ULL));
+static_assert(divide_words_same(0x7fff'ffff'8000'0000ULL, 0x0000'0000'0000'0000ULL, 0x8000'0000'0000'0001ULL));
+static_assert(std::same_as<detail::least_doubled_uint_t<std::uint64_t>, __uint128_t>);
+static_assert(std::same_as<detail::least_doubled_int_t<std::uint64_t>, __int128_t>);
+
+// `UnsignedDoubledLongLong` is only the default double-width type without `__uint128_t`, so it is forced here.
+[[nodiscard]] constexpr auto doubled_modder_same(std::uint64_t m) noexcept -> bool
+{
+    const detail::UnsignedModder<std::uint64_t> native { m };
+    const detail::UnsignedModder<std::uint64_t, detail::UnsignedDoubledLongLong> doubled { m };
+    std::uint64_t x { 0xfedc'ba98'7654'3210ULL };
+    for (int i { 0 }; i < 20; ++i) {
+        const std::uint64_t next { native.times_plus_mod(6364136223846793005U, x, 0xffff'ffff'ffff'ffffULL) };
+        if (next != doubled.times_plus_mod(6364136223846793005U, x, 0xffff'ffff'ffff'ffffULL)
+            || native.minus_mod(native.mod(x), next) != doubled.minus_mod(doubled.mod(x), next)) {
+            return false;
+        }
+        x = next;
+    }
+    return native.pow_mod(x, 0xffff'ffff'ffff'ffffULL) == doubled.pow_mod(x, 0xffff'ffff'ffff'ffffULL)
+        && native(static_cast<__int128_t>(-7)) == doubled(detail::DoubledLongLong { -7 });
+}
+
+static_assert(doubled_modder_same(0));
+static_assert(doubled_modder_same(2305843009213693951U));
+static_assert(doubled_modder_same(18446744073709551615U));
+static_assert(doubled_modder_same(1000000000000000003U));
+static_assert(doubled_modder_same(9223372036854788000U));
+
+// 128-bit states, with `UnsignedDoubled<UnsignedDoubledLongLong>` as double-width type.
+using detail::UnsignedDoubledLongLong;
+using UnsignedQuadLongLong = detail::UnsignedDoubled<UnsignedDoubledLongLong>;
+
+static_assert(std::numeric_limits<UnsignedDoubledLongLong>::digits == 128);
+static_assert(std::numeric_limits<detail::DoubledLongLong>::min() < 0 && std::numeric_limits<detail::DoubledLongLong>::max() > 0);
+static_assert(std::numeric_limits<UnsignedQuadLongLong>::max() + 1U == 0U);
+static_assert(std::same_as<detail::least_doubled_uint_t<UnsignedDoubledLongLong>, UnsignedQuadLongLong>);
+
+[[nodiscard]] constexpr auto quad_division_same(UnsignedQuadLongLong n, UnsignedQuadLongLong d) noexcept -> bool
+{
+    const auto [quotient, remainder] { divide(n, d) };
+    return (quotient * d) + remainder == n && remainder < d;
+}
+
+// The product of two 128-bit values does not wrap, so dividing it gives back the factors.
+[[nodiscard]] constexpr auto quad_product_same(UnsignedDoubledLongLong x, UnsignedDoubledLongLong y) noexcept -> bool
+{
+    const UnsignedQuadLongLong product { UnsignedQuadLongLong { x } * y };
+    return product / x == y && product / y == x && product % x == 0U;
+}
+
+constexpr UnsignedDoubledLongLong odd_128 { UnsignedDoubledLongLong::from_words(0xfedc'ba98'7654'3210ULL, 0x0123'4567'89ab'cdefULL) };
+constexpr UnsignedQuadLongLong odd_256 { UnsignedQuadLongLong::from_words(odd_128, ~odd_128) };
+static_assert(quad_division_same(odd_256, 7U));
+static_assert(quad_division_same(odd_256, odd_128));
+static_assert(quad_division_same(odd_256, UnsignedQuadLongLong::from_words(1U, 0U)));
+static_assert(quad_division_same(odd_256, odd_256 >> 3U));
+static_assert(quad_division_same(~UnsignedQuadLongLong {}, UnsignedQuadLongLong::from_words(0x8000'0000'0000'0000ULL, 1U)));
+static_assert(quad_product_same(odd_128, ~UnsignedDoubledLongLong {}));
+static_assert(quad_product_same(odd_128 >> 70U, odd_128));
+
+// Checks a 128-bit modulus against a reference computing products by doubling and adding.
+[[nodiscard]] constexpr auto wide_reduction_reference_same(detail::ReductionKind kind, UnsignedDoubledLongLong a, UnsignedDoubledLongLong c, UnsignedDoubledLongLong m, UnsignedDoubledLongLong seed) noexcept -> bool
+{
+    const auto plus_mod {
+        [&m](UnsignedDoubledLongLong x, UnsignedDoubledLongLong y) noexcept -> UnsignedDoubledLongLong {
+            return x >= m - y ? x - (m - y) : x + y;
+        }
+    };
+    const auto times_mod {
+        [&plus_mod](UnsignedDoubledLongLong x, UnsignedDoubledLongLong y) noexcept -> UnsignedDoubledLongLong {
+            UnsignedDoubledLongLong result { 0U };
+            for (/* void */; y != 0U; y >>= 1U) {
+                if ((y & 1U) != 0U) {
+                    result = plus_mod(result, x);
+                }
+                x = plus_mod(x, x);
+            }
+            return result;
+        }
+    };
+    LCGEngine<UnsignedDoubledLongLong> engine { a, c, m, seed };
+    const std::optional<LCGAffineTransform<UnsignedDoubledLongLong>> inverse { engine.affine().inverse() };
+    UnsignedDoubledLongLong state { seed % m };
+    for (int i { 0 }; i != 20; ++i) {
+        state = plus_mod(times_mod(a % m, state), c % m);
+        if (engine() != state) {
+            return false;
+        }
+    }
+    return engine.affine().modder().kind() == kind
+        && inverse.has_value() && compose(*inverse, engine.affine()) == engine.affine().identity();
+}
+
+constexpr UnsignedDoubledLongLong mersenne_127 { (UnsignedDoubledLongLong { 1U } << 127U) - 1U };
+constexpr UnsignedDoubledLongLong prime_10_38 { (UnsignedDoubledLongLong { 10'000'000'000'000'000'000ULL } * 10'000'000'000'000'000'000ULL) + 3U };
+static_assert(wide_reduction_reference_same(detail::ReductionKind::mersenne, odd_128, ~odd_128, mersenne_127, 42U));
+static_assert(wide_reduction_reference_same(detail::ReductionKind::barrett, odd_128, ~odd_128, prime_10_38, 42U));
+static_assert(wide_reduction_reference_same(detail::ReductionKind::barrett, odd_128, 1U, ~UnsignedDoubledLongLong {} - 58U, odd_128));
+
+// The LCG of PCG64 (PCG XSL RR 128/64), with period 2^128.
+constexpr UnsignedDoubledLongLong pcg64_a { UnsignedDoubledLongLong::from_words(0x2360'ed05'1fc6'5da4ULL, 0x4385'df64'9fcc'f645ULL) };
+constexpr UnsignedDoubledLongLong pcg64_c { UnsignedDoubledLongLong::from_words(0x5851'f42d'4c95'7f2dULL, 0x1405'7b7e'f767'814fULL) };
+constexpr LCGEngine<UnsignedDoubledLongLong> pcg64_engine { pcg64_a, pcg64_c, 0U, odd_128 };
+
+static_assert([] {
+    LCGEngine<UnsignedDoubledLongLong> engine { pcg64_engine };
+    return engine() == (pcg64_a * odd_128) + pcg64_c && engine() == (pcg64_a * ((pcg64_a * odd_128) + pcg64_c)) + pcg64_c;
+}());
+static_assert(compose(pcg64_engine.affine().powered(~UnsignedDoubledLongLong {}), pcg64_engine.affine()) == pcg64_engine.affine().identity());
+static_assert(pcg64_engine.affine().powered(~UnsignedDoubledLongLong {}) == pcg64_engine.affine().inverse());
+static_assert([] {
+    const UnsignedDoubledLongLong n1 { odd_128 };
+    const UnsignedDoubledLongLong n2 { ~odd_128 >> 5U };
+    LCGEngine<UnsignedDoubledLongLong> engine { pcg64_engine };
+    engine.discard(n1);
+    engine.discard(n2);
+    return engine.state() == pcg64_engine.value_after_n_steps(n1 + n2)
+        && engine.value_before_n_steps(n1 + n2) == pcg64_engine.state()
+        && pcg64_engine.value_after_n_steps(UnsignedDoubledLongLong { 1000U }) == pcg64_engine.value_after_n_steps(1000);
+}());
+
+#if defined(__SIZEOF_INT128__)
+// `__uint128_t` states give the same values, with the native 128-bit arithmetic.
+static_assert([] {
+    LCGEngine<__uint128_t> native { static_cast<__uint128_t>(pcg64_a), static_cast<__uint128_t>(pcg64_c), 0U, static_cast<__uint128_t>(odd_128) };
+    LCGEngine<UnsignedDoubledLongLong> portable { pcg64_engine };
+    native.discard(static_cast<__uint128_t>(~odd_128));
+    portable.discard(~odd_128);
+    return native() == static_cast<__uint128_t>(portable())
+        && native.value_after_n_steps(12345) == static_cast<__uint128_t>(portable.value_after_n_steps(12345));
+}());
+static_assert([] {
+    LCGEngine<__uint128_t> native { static_cast<__uint128_t>(odd_128), 1U, static_cast<__uint128_t>(prime_10_38), 42U };
+    LCGEngine<UnsignedDoubledLongLong> portable { odd_128, 1U, prime_10_38, 42U };
+    native.discard(-1000);
+    portable.discard(-1000);
+    return native() == static_cast<__uint128_t>(portable());
+}());
+#endif
+
+static_assert(LCGAffineTransform<std::uint64_t> { 1, 2, 7 } - LCGAffineTransform<std::uint64_t> { 2, 5, 7 } == LCGAffineTransform<std::uint64_t> { 6, 4, 7 });
+
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto generation_simulation_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    LCGEngine<T> generating { engine };
+    LCGEngine<T> simulating { engine };
+    std::array<T, step> generation {};
+    generating.generate(generation);
+    return std::ranges::equal(generation, get_simulation<step, T>(engine))
+        && (simulating.discard(step), simulating == generating);
+}
+
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto generation_simulation_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    constexpr std::size_t lanes { LCGEngine<T>::generation_lanes };
+    return generation_simulation_same<0>(engine)
+        && generation_simulation_same<1>(engine)
+        && generation_simulation_same<(2 * lanes) - 1>(engine)
+        && generation_simulation_same<2 * lanes>(engine)
+        && generation_simulation_same<(3 * lanes) + 1>(engine)
+        && generation_simulation_same<1000>(engine);
+}
+
+// `generate_n` through an iterator that is not contiguous.
+static_assert([] {
+    LCGEngine<std::uint_fast32_t> engine { minstd_rand0_engine.affine(), 42 };
+    std::vector<std::uint_fast32_t> generation {};
+    engine.generate_n(std::back_inserter(generation), 1000);
+    return std::ranges::equal(generation, get_simulation<1000, std::uint_fast32_t>(LCGEngine<std::uint_fast32_t> { minstd_rand0_engine.affine(), 42 }));
+}());
+
+static_assert(generation_simulation_same(LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 42 }));
+static_assert(generation_simulation_same(LCGEngine<std::uint32_t> { 1588635695, 12345, 0, 42 }));
+static_assert(generation_simulation_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+static_assert(generation_simulation_same(LCGEngine<std::uint8_t> { 37, 7, 128, 42 }));
+
+// Deals the next `k * block_len` values out with `split_block` and `split_leapfrog`, and collects them back.
+template <std::size_t k, std::size_t block_len, std::unsigned_integral T>
+[[nodiscard]] constexpr auto split_simulation_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    const std::array<T, k * block_len> simulation { get_simulation<k * block_len, T>(engine) };
+    std::array<T, k * block_len> blocks {};
+    std::array<T, k * block_len> leapfrogs {};
+    for (std::size_t i { 0 }; i != k; ++i) {
+        LCGSubstream<T> block { engine.split_block(k, i, block_len) };
+        LCGSubstream<T> leapfrog { engine.split_leapfrog(k, i) };
+        // The descriptor carries everything a remote worker needs.
+        LCGSubstream<T> remote_leapfrog { LCGSubstream<T> { leapfrog.descriptor() } };
+        for (std::size_t j { 0 }; j != block_len; ++j) {
+            blocks[(i * block_len) + j] = block();
+            leapfrogs[i + (j * k)] = leapfrog();
+            if (remote_leapfrog() != leapfrogs[i + (j * k)]) {
+                return false;
+            }
+        }
+    }
+    return blocks == simulation && leapfrogs == simulation;
+}
+
+static_assert(split_simulation_same<7, 13>(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+
+// Steps forwards, then backwards by `value_before_n_steps` and signed `discard`, with and without a jump table.
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto rewind_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    const LCGJumpTable<T, 4> table { engine.affine() };
+    const std::optional<LCGAffineTransform<T>> inverse { engine.affine().inverse() };
+    const std::optional<LCGJumpTable<T, 4>> inverse_table { table.inverse_table() };
+    if (!inverse.has_value() || compose(engine.affine(), *inverse) != engine.affine().identity()
+        || compose(*inverse, engine.affine()) != engine.affine().identity() || !inverse_table.has_value()
+        || inverse_table->affine() != inverse || table.inverse() != inverse || inverse_table->inverse() != engine.affine()) {
+        return false;
+    }
+
+    LCGEngine<T> stepped { engine };
+    LCGEngine<T> rewound { engine };
+    LCGEngine<T> table_rewound { engine };
+    rewound.discard(static_cast<long long>(step));
+    table_rewound.discard(static_cast<long long>(step), table);
+    for (std::size_t i { 0 }; i != step; ++i) {
+        static_cast<void>(stepped());
+        if (stepped.value_before_n_steps(i + 1) != engine.state() || stepped.value_before_n_steps(i + 1, *inverse_table) != engine.state()
+            || stepped.try_value_before_n_steps(i + 1) != engine.state()) {
+            return false;
+        }
+    }
+    if (rewound != stepped || table_rewound != stepped) {
+        return false;
+    }
+    rewound.discard(-static_cast<long long>(step));
+    table_rewound.discard(-static_cast<long long>(step), table);
+    stepped.discard(-static_cast<long long>(step), table, *inverse_table);
+    return rewound == engine && table_rewound == engine && stepped == engine && inverse_table->powered(step) == inverse->powered(step);
+}
+
+static_assert(rewind_same<100>(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }));
+static_assert(rewind_same<100>(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+static_assert(rewind_same<100>(LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 42 }));
+static_assert(!LCGAffineTransform<std::uint32_t> { 2, 1, 0 }.inverse().has_value());
+static_assert(!LCGJumpTable<std::uint32_t, 4> { LCGAffineTransform<std::uint32_t> { 2, 1, 0 } }.inverse_table().has_value());
+static_assert(!LCGEngine<std::uint32_t> { 2, 1, 0, 42 }.try_value_before_n_steps(1).has_value());
+static_assert(!LCGAffineTransform<std::uint32_t> { 6, 1, 9 }.inverse().has_value());
+static_assert(LCGAffineTransform<std::uint32_t> { 7, 1, 1 }.inverse().has_value());
+static_assert(minstd_rand_static_engine.value_before_n_steps(1) == minstd_rand_static_engine.to_dynamic().value_before_n_steps(1));
+static_assert(minstd_rand_static_engine.value_before_n_steps(0x0123'4567'89ab'cdefULL) == minstd_rand_engine.value_before_n_steps(0x0123'4567'89ab'cdefULL));
+static_assert(minstd_rand_static_engine.inverse_jump_table().affine() == minstd_rand_engine.affine().inverse());
+
+// Answers sorted, unsorted and repeated indices in one batch, with and without a prebuilt table.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto values_at_same(const LCGEngine<T>& engine) -> bool
+{
+    const LCGJumpTable<T, 2> table { engine.affine() };
+    const auto same_for {
+        [&engine, &table](const std::vector<unsigned long long>& indices) -> bool {
+            std::vector<T> values(indices.size());
+            std::vector<T> table_values(indices.size());
+            engine.values_at(indices, values);
+            engine.values_at(indices, table_values, table);
+            return values == table_values
+                && std::ranges::equal(indices, values, {}, [&engine](unsigned long long n) -> T { return engine.value_after_n_steps(n); });
+        }
+    };
+    return same_for({})
+        && same_for({ 0, 1, 2, 3, 100, 100, 12345 })
+        && same_for({ 12345, 0, 7, 100, 7, std::numeric_limits<unsigned long long>::max(), 1, 0x8000'0000'0000'3039ULL })
+        && same_for({ 0x0123'4567'89ab'cdefULL, 0x0123'4567'89ab'cdeeULL, 42 })
+        // From `LCGEngine<T>::values_at_min_table_size` indices, the call without a table builds one.
+        && same_for({ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 1000, 2000, 3000, 0x8000'0000'0000'3039ULL, 17, 16 });
+}
+
+// Indices of other unsigned types, e.g. `std::uint64_t`, which is `unsigned long` on LP64 platforms.
+[[nodiscard]] constexpr auto values_at_index_types_same() -> bool
+{
+    const std::vector<std::uint64_t> indices { 3, 1, 2, 0x0123'4567'89ab'cdefULL, 0, 1000, 2000, 3000, 4000, 5000, 6000, 7000 };
+    const std::vector<std::uint32_t> narrow_indices { 3, 1, 2, 0x89ab'cdefU };
+    std::vector<std::uint_fast64_t> values(indices.size());
+    std::vector<std::uint_fast64_t> table_values(indices.size());
+    std::vector<std::uint_fast64_t> narrow_values(narrow_indices.size());
+    musl_rand_engine.values_at(indices, values);
+    musl_rand_engine.values_at(indices, table_values, LCGJumpTable<std::uint_fast64_t, 2> { musl_rand_engine.affine() });
+    musl_rand_engine.values_at(narrow_indices, narrow_values);
+    std::vector<std::uint_fast64_t> temporary_values(3);
+    musl_rand_engine.values_at(std::vector<std::uint64_t> { 3, 1, 2 }, temporary_values);
+    const auto expected { [](std::uint64_t n) -> std::uint_fast64_t { return musl_rand_engine.value_after_n_steps(n); } };
+    return std::ranges::equal(indices, values, {}, expected) && values == table_values
+        && std::ranges::equal(narrow_indices, narrow_values, {}, expected) && std::ranges::equal(temporary_values, values | std::views::take(3));
+}
+
+static_assert(values_at_index_types_same());
+static_assert(values_at_same(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }));
+static_assert(values_at_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+static_assert(values_at_same(LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 42 }));
+
+// Compares `sum_of_next` and `sum_of_squares_of_next` with sums of `operator()`, for some n up to `step`.
+template <std::size_t step, detail::unsigned_integer_like T>
+[[nodiscard]] constexpr auto sums_simulation_same(LCGEngine<T> engine) noexcept -> bool
+{
+    const detail::UnsignedModder<T> modder { engine.m() };
+    const LCGEngine<T> start { engine };
+    T sum { 0 };
+    T sum_of_squares { 0 };
+    for (std::size_t n { 0 }; n <= step; ++n) {
+        const bool checked { n <= 3 || n == step / 2 || n == step - 1 || n == step };
+        if (checked && (start.sum_of_next(n) != sum || start.sum_of_squares_of_next(n) != sum_of_squares)) {
+            return false;
+        }
+        const T value { engine() };
+        sum = modder.plus_mod(sum, value);
+        sum_of_squares = modder.plus_mod(sum_of_squares, modder.times_mod(value, value));
+    }
+    return true;
+}
+
+static_assert(sums_simulation_same<100>(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }));
+static_assert(sums_simulation_same<100>(LCGEngine<std::uint8_t> { 6, 1, 0, 42 }));
+static_assert(sums_simulation_same<100>(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+static_assert(sums_simulation_same<100>(LCGEngine<std::uint64_t> { 3935559000370003845U, 2691343689449507681U, 1000000000000000003U, 42 }));
+// The sum of x over a full period of a bijection modulo 2^8 is 0 + 1 + ... + 255, and likewise for the squares.
+static_assert(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }.sum_of_next(256) == 128);
+static_assert(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }.sum_of_squares_of_next(256) == 128);
+static_assert(sums_simulation_same<20>(pcg64_engine));
+static_assert(sums_simulation_same<20>(LCGEngine<UnsignedDoubledLongLong> { odd_128, 1U, prime_10_38, 42U }));
+
+static_assert(std::ranges::random_access_range<LCGSequenceView<std::uint32_t>>);
+static_assert(std::ranges::sized_range<LCGSequenceView<std::uint32_t>>);
+static_assert(std::ranges::borrowed_range<LCGSequenceView<std::uint32_t>>);
+static_assert(std::ranges::view<LCGSequenceView<std::uint32_t>>);
+static_assert(std::sized_sentinel_for<LCGSequenceView<std::uint32_t>::iterator, LCGSequenceView<std::uint32_t>::iterator>);
+
+// Reads a window of `sequence()` forwards, backwards, by index and by iterator jumps, against `operator()`.
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto sequence_simulation_same(const LCGEngine<T>& engine) noexcept -> bool
+{
+    constexpr std::size_t first { step / 3 };
+    const std::array<T, step> simulation { get_simulation<step, T>(engine) };
+    const auto window { std::span { simulation }.subspan(first) };
+    const LCGSequenceView<T> sequence { engine.sequence(first, step) };
+    const auto at {
+        [&sequence, &window](std::size_t i) noexcept -> bool {
+            const auto it { sequence.begin() + static_cast<std::ptrdiff_t>(i) };
+            return sequence[i] == window[i] && *it == window[i] && (sequence.end() - static_cast<std::ptrdiff_t>(window.size() - i))[0] == window[i]
+                && it - sequence.begin() == static_cast<std::ptrdiff_t>(i);
+        }
+    };
+    const std::ranges::subrange tail { sequence.begin() + 5, sequence.end() };
+    return std::ranges::equal(sequence, window)
+        && std::ranges::equal(sequence | std::views::reverse, window | std::views::reverse)
+        && std::ranges::equal(tail, window.subspan(5))
+        && std::ranges::all_of(std::views::iota(std::size_t { 0 }, window.size()), at)
+        && sequence.size() == window.size()
+        && std::ranges::find(sequence, window[7]) - sequence.begin() == std::ranges::find(window, window[7]) - window.begin()
+        && engine.sequence(step).back() == simulation.back()
+        && engine.sequence(0).empty();
+}
+
+static_assert(sequence_simulation_same<100>(LCGEngine<std::uint8_t> { 37, 7, 0, 42 }));
+static_assert(sequence_simulation_same<100>(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }));
+// The iterators outlive the temporary view.
+static_assert(*std::ranges::max_element(krc_rand_engine.sequence(10)) == std::ranges::max(get_simulation<10>(krc_rand_engine)));
+
+// Jumps `n` steps, and asks how far the jump went. `n` is less than the period, so it is the least answer.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto steps_between_same(const LCGEngine<T>& engine, unsigned long long n) -> bool
+{
+    return engine.steps_between(engine.state(), engine.value_after_n_steps(n)) == n
+        && engine.steps_between(engine.value_after_n_steps(n), engine.value_after_n_steps(n)) == 0;
+}
+
+static_assert(detail::is_prime(std::uint64_t { 1000000000000000003U }));
+static_assert(!detail::is_prime(std::uint64_t { 3215031751U })); // Strong pseudoprime to bases 2, 3, 5 and 7.
+static_assert(detail::factorize(std::uint64_t { 2147483646U }) == std::vector<detail::PrimePower<std::uint64_t>> { { 2, 1 }, { 3, 2 }, { 7, 1 }, { 11, 1 }, { 31, 1 }, { 151, 1 }, { 331, 1 } });
+static_assert(detail::factorize(std::uint64_t { 1000003ULL * 1000033ULL * 1024 }) == std::vector<detail::PrimePower<std::uint64_t>> { { 2, 10 }, { 1000003, 1 }, { 1000033, 1 } });
+// 2 has order 3 modulo 7: 1, 2, 4.
+static_assert(LCGEngine<std::uint8_t> { 2, 0, 7 }.steps_between(1, 4) == 2);
+static_assert(!LCGEngine<std::uint8_t> { 2, 0, 7 }.steps_between(1, 3).has_value());
+static_assert(!LCGEngine<std::uint8_t> { 2, 0, 7 }.steps_between(1, 0).has_value());
+static_assert(LCGEngine<std::uint8_t> { 1, 3, 7 }.steps_between(1, 0) == 2);
+static_assert(LCGEngine<std::uint8_t> { 0, 3, 7 }.steps_between(1, 3) == 1);
+// a even modulo 2^k: every orbit ends in a fixed point.
+static_assert(LCGEngine<std::uint8_t> { 6, 1, 0 }.steps_between(0, 7) == 2);
+static_assert(!LCGEngine<std::uint8_t> { 6, 1, 0 }.steps_between(7, 0).has_value());
+// c even modulo 2^k: no orbit changes the parity.
+static_assert(!LCGEngine<std::uint32_t> { 5, 2, 0 }.steps_between(1, 2).has_value());
+static_assert(steps_between_same(LCGEngine<std::uint32_t> { 5, 2, 0, 1 }, 1000000));
+static_assert(steps_between_same(LCGEngine<std::uint16_t> { 17364, 1, 65521, 42 }, 12345));
+// 20014600420 = 2^2 * 5 * 10007 * 100003, which is also the order of a: the last two factors are found by Pollard's rho.
+static_assert(steps_between_same(LCGEngine<std::uint64_t> { 1234567896, 987654321, 20014600421, 42 }, 19876543210));
+
+// Checks `period` and `cycle_length` against stepping until the sequence repeats, for every seed. Every tail is
+// shorter than the number of digits, so the sequence is on its cycle after that many steps.
+template <std::unsigned_integral T>
+[[nodiscard]] constexpr auto cycles_stepping_same(T a, T c, T m) -> bool
+{
+    const LCGAffineTransform<T> f { a, c, m };
+    const LCGCycleStructure<T> structure { f };
+    const unsigned long long real_m { m != 0 ? m : std::numeric_limits<T>::max() + 1ULL };
+    unsigned long long longest { 0 };
+    for (unsigned long long x { 0 }; x != real_m; ++x) {
+        T on_cycle { static_cast<T>(x) };
+        for (int i { 0 }; i != std::numeric_limits<T>::digits; ++i) {
+            on_cycle = f(on_cycle);
+        }
+        unsigned long long length { 1 };
+        for (T y { f(on_cycle) }; y != on_cycle; y = f(y)) {
+            ++length;
+        }
+        if (structure.cycle_length(static_cast<T>(x)) != length) {
+            return false;
+        }
+        longest = std::max(longest, length);
+    }
+    return structure.period() == longest && f.period() == longest;
+}
+
+// Single cycles by the Hull-Dobell theorem, and not: c even, a = 3 (mod 4), a even, and a = 1.
+static_assert(cycles_stepping_same<std::uint8_t>(37, 7, 0));
+static_assert(cycles_stepping_same<std::uint8_t>(37, 6, 0));
+static_assert(cycles_stepping_same<std::uint8_t>(35, 7, 0));
+static_assert(cycles_stepping_same<std::uint8_t>(6, 3, 0));
+static_assert(cycles_stepping_same<std::uint8_t>(1, 0, 0));
+static_assert(cycles_stepping_same<std::uint8_t>(5, 0, 64));
+// Composite moduli: 100 = 2^2 * 5^2 with a single cycle and not, 12 with a even, 45 with 5 | a but not 3, and 200 with a tail.
+static_assert(cycles_stepping_same<std::uint16_t>(21, 3, 100));
+static_assert(cycles_stepping_same<std::uint16_t>(11, 10, 100));
+static_assert(cycles_stepping_same<std::uint16_t>(7, 3, 100));
+static_assert(cycles_stepping_same<std::uint16_t>(6, 5, 12));
+static_assert(cycles_stepping_same<std::uint16_t>(10, 7, 45));
+static_assert(cycles_stepping_same<std::uint16_t>(4, 2, 200));
+// Primes: a of every order, and m == 1.
+static_assert(cycles_stepping_same<std::uint32_t>(5, 0, 97));
+static_assert(cycles_stepping_same<std::uint32_t>(35, 11, 97));
+static_assert(cycles_stepping_same<std::uint32_t>(6, 1, 251));
+static_assert(cycles_stepping_same<std::uint32_t>(3, 1, 1));
+// 2147483646 = 2 * 3^2 * 7 * 11 * 31 * 151 * 331: 48271 and 16807 are primitive roots, 48271^2 is not.
+static_assert(minstd_rand_engine.period() == 2147483646U && minstd_rand0_engine.period() == 2147483646U);
+static_assert(LCGEngine<std::uint_fast32_t> { 48271U * 48271U, 0, 2147483647 }.period() == 1073741823U);
+static_assert(LCGEngine<std::uint_fast32_t> { 48271, 0, 2147483647, 0 }.cycle_length() == 1U);
+static_assert(LCGEngine<std::uint_fast32_t> { 48271, 0, 2147483647, 12345 }.cycle_length(LCGCycleStructure<std::uint_fast32_t> { minstd_rand_engine.affine() }) == 2147483646U);
+static_assert(krc_rand_static_engine.period() == 2147483648U && msvc_rand_static_engine.period() == 2147483648U);
+static_assert(posix_rand48_static_engine.period() == 281474976710656U && posix_rand48_engine.cycle_length() == 281474976710656U);
+static_assert(musl_rand_static_engine.period() == __uint128_t { 1 } << 64U);
+// c even modulo 2^64: each parity class is its own set of cycles, of length at most 2^63.
+static_assert(LCGEngine<std::uint64_t> { 6364136223846793005U, 2, 0, 1 }.cycle_length() == __uint128_t { 1 } << 63U);
+
 // https://oeis.org/A096553 (without the first term 1)
 constexpr inline std::array<std::uint_fast32_t, 10> krc_lcg_actual {
     1103527590, 377401575, 662824084, 1147902781, 2035015474,
@@ -65,6 +702,17 @@ constexpr inline std::array<std::uint_fast32_t, 10> krc_lcg_actual {
 static_assert(prediction_actual_same(krc_rand_engine, krc_lcg_actual));
 static_assert(simulation_actual_same(krc_rand_engine, krc_lcg_actual));
 static_assert(prediction_simulation_same<1000>(krc_rand_engine));
+static_assert(jump_table_prediction_same<1, 100>(krc_rand_engine));
+static_assert(jump_table_prediction_same<4, 100>(krc_rand_engine));
+static_assert(generation_simulation_same(krc_rand_engine));
+static_assert(split_simulation_same<8, 25>(krc_rand_engine));
+static_assert(rewind_same<100>(krc_rand_engine));
+static_assert(values_at_same(krc_rand_engine));
+static_assert(sequence_simulation_same<100>(krc_rand_engine));
+static_assert(sums_simulation_same<100>(krc_rand_engine));
+static_assert(steps_between_same(krc_rand_engine, 2000000000));
+static_assert(static_dynamic_same<1000>(krc_rand_static_engine, krc_rand_engine));
+static_assert(preset_jump_table_same(krc_rand_engine));
 
 // Operations on `std::linear_congruential_engine` are not `constexpr`, so actual values are hard-coded.
 // https://oeis.org/A221556
@@ -76,6 +724,17 @@ constexpr inline std::array<std::uint_fast32_t, 10> minstd_rand_actual {
 static_assert(prediction_actual_same(minstd_rand_engine, minstd_rand_actual));
 static_assert(simulation_actual_same(minstd_rand_engine, minstd_rand_actual));
 static_assert(prediction_simulation_same<1000>(minstd_rand_engine));
+static_assert(jump_table_prediction_same<1, 100>(minstd_rand_engine));
+static_assert(jump_table_prediction_same<4, 100>(minstd_rand_engine));
+static_assert(generation_simulation_same(minstd_rand_engine));
+static_assert(split_simulation_same<8, 25>(minstd_rand_engine));
+static_assert(rewind_same<100>(minstd_rand_engine));
+static_assert(values_at_same(minstd_rand_engine));
+static_assert(sequence_simulation_same<100>(minstd_rand_engine));
+static_assert(sums_simulation_same<100>(minstd_rand_engine));
+static_assert(steps_between_same(minstd_rand_engine, 2000000000));
+static_assert(static_dynamic_same<1000>(minstd_rand_static_engine, minstd_rand_engine));
+static_assert(preset_jump_table_same(minstd_rand_engine));
 static_assert(minstd_rand_engine.value_after_n_steps(10000) == 399268537);
 
 // Operations on `std::linear_congruential_engine` are not `constexpr`, so actual values are hard-coded.
@@ -88,7 +747,19 @@ constexpr inline std::array<std::uint_fast32_t, 10> minstd_rand0_actual {
 static_assert(prediction_actual_same(minstd_rand0_engine, minstd_rand0_actual));
 static_assert(simulation_actual_same(minstd_rand0_engine, minstd_rand0_actual));
 static_assert(prediction_simulation_same<1000>(minstd_rand0_engine));
+static_assert(jump_table_prediction_same<1, 100>(minstd_rand0_engine));
+static_assert(jump_table_prediction_same<4, 100>(minstd_rand0_engine));
+static_assert(generation_simulation_same(minstd_rand0_engine));
+static_assert(split_simulation_same<8, 25>(minstd_rand0_engine));
+static_assert(rewind_same<100>(minstd_rand0_engine));
+static_assert(values_at_same(minstd_rand0_engine));
+static_assert(sequence_simulation_same<100>(minstd_rand0_engine));
+static_assert(sums_simulation_same<100>(minstd_rand0_engine));
+static_assert(steps_between_same(minstd_rand0_engine, 2147483000));
+static_assert(static_dynamic_same<1000>(minstd_rand0_static_engine, minstd_rand0_engine));
+static_assert(preset_jump_table_same(minstd_rand0_engine));
 static_assert(minstd_rand0_engine.value_after_n_steps(10000) == 1043618065);
+static_assert(minstd_rand0_engine.value_after_n_steps(10000, LCGJumpTable<std::uint_fast32_t, 3> { minstd_rand0_engine.affine() }) == 1043618065);
 
 // https://oeis.org/A384331 (without the first term 1)
 constexpr inline std::array<std::uint_fast32_t, 10> msvc_rand_actual {
@@ -99,6 +770,17 @@ constexpr inline std::array<std::uint_fast32_t, 10> msvc_rand_actual {
 static_assert(prediction_actual_same(msvc_rand_engine, msvc_rand_actual));
 static_assert(simulation_actual_same(msvc_rand_engine, msvc_rand_actual));
 static_assert(prediction_simulation_same<1000>(msvc_rand_engine));
+static_assert(jump_table_prediction_same<1, 100>(msvc_rand_engine));
+static_assert(jump_table_prediction_same<4, 100>(msvc_rand_engine));
+static_assert(generation_simulation_same(msvc_rand_engine));
+static_assert(split_simulation_same<8, 25>(msvc_rand_engine));
+static_assert(rewind_same<100>(msvc_rand_engine));
+static_assert(values_at_same(msvc_rand_engine));
+static_assert(sequence_simulation_same<100>(msvc_rand_engine));
+static_assert(sums_simulation_same<100>(msvc_rand_engine));
+static_assert(steps_between_same(msvc_rand_engine, 2000000000));
+static_assert(static_dynamic_same<1000>(msvc_rand_static_engine, msvc_rand_engine));
+static_assert(preset_jump_table_same(msvc_rand_engine));
 
 // https://oeis.org/A382305 (without the first term 1)
 constexpr inline std::array<std::uint_fast64_t, 10> rand48_actual {
@@ -109,6 +791,17 @@ constexpr inline std::array<std::uint_fast64_t, 10> rand48_actual {
 static_assert(prediction_actual_same(posix_rand48_engine, rand48_actual));
 static_assert(simulation_actual_same(posix_rand48_engine, rand48_actual));
 static_assert(prediction_simulation_same<1000>(posix_rand48_engine));
+static_assert(jump_table_prediction_same<1, 100>(posix_rand48_engine));
+static_assert(jump_table_prediction_same<4, 100>(posix_rand48_engine));
+static_assert(generation_simulation_same(posix_rand48_engine));
+static_assert(split_simulation_same<8, 25>(posix_rand48_engine));
+static_assert(rewind_same<100>(posix_rand48_engine));
+static_assert(values_at_same(posix_rand48_engine));
+static_assert(sequence_simulation_same<100>(posix_rand48_engine));
+static_assert(sums_simulation_same<100>(posix_rand48_engine));
+static_assert(steps_between_same(posix_rand48_engine, 281474976710000));
+static_assert(static_dynamic_same<1000>(posix_rand48_static_engine, posix_rand48_engine));
+static_assert(preset_jump_table_same(posix_rand48_engine));
 
 constexpr inline std::array<std::uint_fast64_t, 10> musl_rand_actual {
     6364136223846793006U, 13885033948157127959U, 14678909342070756876U, 14340359694176818205U, 3490389784639564826U,
@@ -118,6 +811,62 @@ constexpr inline std::array<std::uint_fast64_t, 10> musl_rand_actual {
 static_assert(prediction_actual_same(musl_rand_engine, musl_rand_actual));
 static_assert(simulation_actual_same(musl_rand_engine, musl_rand_actual));
 static_assert(prediction_simulation_same<1000>(musl_rand_engine));
+static_assert(jump_table_prediction_same<1, 100>(musl_rand_engine));
+static_assert(jump_table_prediction_same<4, 100>(musl_rand_engine));
+static_assert(generation_simulation_same(musl_rand_engine));
+static_assert(split_simulation_same<8, 25>(musl_rand_engine));
+static_assert(rewind_same<100>(musl_rand_engine));
+static_assert(values_at_same(musl_rand_engine));
+static_assert(sequence_simulation_same<100>(musl_rand_engine));
+static_assert(sums_simulation_same<100>(musl_rand_engine));
+static_assert(steps_between_same(musl_rand_engine, 18446744073709551000U));
+static_assert(static_dynamic_same<1000>(musl_rand_static_engine, musl_rand_engine));
+static_assert(preset_jump_table_same(musl_rand_engine));
+
+// `from_std` takes the state of a standard engine as the one before its next output, when a is invertible.
+template <std::unsigned_integral T, T a, T c, T m>
+[[nodiscard]] constexpr auto std_state_before_same(StaticLCGEngine<T, a, c, m> engine) noexcept -> bool
+{
+    const T state { engine.state() };
+    return detail::std_lcg_state_before<T, a, c, m>(engine()) == state;
+}
+
+static_assert(std_state_before_same(krc_rand_static_engine));
+static_assert(std_state_before_same(minstd_rand_static_engine));
+static_assert(std_state_before_same(StaticLCGEngine<std::uint_fast32_t, 16807, 0, 2147483647> { 2147483646 }));
+static_assert(std_state_before_same(msvc_rand_static_engine));
+static_assert(std_state_before_same(StaticLCGEngine<std::uint_fast64_t, 25214903917, 11, 281474976710656> { 0 }));
+static_assert(std_state_before_same(StaticLCGEngine<std::uint_fast64_t, 6364136223846793005, 1, 0> { 18446744073709551615U }));
+static_assert(std_state_before_same(StaticLCGEngine<std::uint16_t, 17364, 0, 65521> { 12345 }));
+// An even a modulo a power of 2 loses the low bit, so only the stream operator gives the state.
+static_assert(!detail::std_lcg_a_inverse<std::uint32_t, 2, 0>.has_value());
+static_assert(!detail::std_lcg_a_inverse<std::uint32_t, 6, 9>.has_value());
+
+// Outputs of K&R and MSVC `rand()` after `srand(1)`.
+constexpr inline std::array<std::uint_fast32_t, 10> krc_rand_output_actual {
+    16838, 5758, 10113, 17515, 31051, 5627, 23010, 7419, 16212, 4086
+};
+constexpr inline std::array<std::uint_fast32_t, 10> msvc_rand_output_actual {
+    41, 18467, 6334, 26500, 19169, 15724, 11478, 29358, 26962, 24464
+};
+
+template <std::size_t step, std::unsigned_integral T>
+[[nodiscard]] constexpr auto output_actual_same(const ProjectedLCGEngine<T>& engine, const std::array<T, step>& actual) noexcept -> bool
+{
+    ProjectedLCGEngine<T> simulating { engine };
+    for (std::size_t i { 0 }; i != step; ++i) {
+        if (engine.value_after_n_steps(i + 1) != actual[i] || simulating() != actual[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(output_actual_same(krc_rand_output_engine, krc_rand_output_actual));
+static_assert(output_actual_same(msvc_rand_output_engine, msvc_rand_output_actual));
+static_assert(posix_lrand48_projection(0xFFFF'FFFF'FFFFU) == 0x7FFF'FFFFU);
+static_assert(musl_rand_projection(0xFFFF'FFFF'FFFF'FFFFU) == 0x7FFF'FFFFU);
+static_assert(minstd_rand_output_engine.value_after_n_steps(10000) == 399268537);
 
 }
 